@@ -0,0 +1,387 @@
+// Monte Carlo balancing: thousands of seeded bot sessions across all cores,
+// reporting how streak, score, time-to-fail and difficulty steps are spread
+// for the current tuning or for every point of a sweep. See Readme.md.
+
+#include "../nah2nah3.c"
+#include "session.h"
+
+#include <getopt.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#define BALANCE_MAX_SWEEP 4
+#define BALANCE_MAX_VALUES 16
+
+typedef struct {
+    const TuningField* field;
+    uint32_t values[BALANCE_MAX_VALUES];
+    int value_count;
+} SweepAxis;
+
+typedef struct {
+    int score;
+    int max_streak;
+    bool failed;
+    uint32_t fail_ms; // First fail, or the session length if it never failed
+    uint32_t fails;
+    uint32_t first_step_ms; // First difficulty step, 0 if none
+    uint32_t steps;
+    uint8_t accuracy_pct;
+    uint16_t latency_ms;
+} SessionResult;
+
+typedef struct {
+    GameState game;
+    uint32_t sessions;
+    uint32_t session_ms;
+    uint32_t seed;
+    uint8_t accuracy_min, accuracy_max;
+    uint16_t latency_min, latency_max;
+    uint16_t jitter_ms;
+    SweepAxis axes[BALANCE_MAX_SWEEP];
+    int axis_count;
+    uint32_t config_count;
+    GameTuning* configs;
+    SessionResult* results; // config_count * sessions
+    atomic_uint next_job;
+} Balance;
+
+// "name=v1,v2,..." into the next sweep axis
+static bool balance_parse_axis(Balance* balance, const char* arg) {
+    const char* eq = strchr(arg, '=');
+    if(!eq || balance->axis_count >= BALANCE_MAX_SWEEP) return false;
+    SweepAxis* axis = &balance->axes[balance->axis_count];
+    axis->field = tuning_field_find(arg, eq - arg);
+    if(!axis->field) return false;
+    axis->value_count = 0;
+    const char* cursor = eq + 1;
+    while(*cursor && axis->value_count < BALANCE_MAX_VALUES) {
+        char* next;
+        axis->values[axis->value_count++] = strtoul(cursor, &next, 0);
+        if(next == cursor) return false;
+        cursor = *next == ',' ? next + 1 : next;
+    }
+    if(axis->value_count == 0) return false;
+    balance->axis_count++;
+    return true;
+}
+
+static bool balance_parse_range(const char* arg, uint32_t* min, uint32_t* max) {
+    char* next;
+    *min = strtoul(arg, &next, 0);
+    if(next == arg) return false;
+    *max = *next == ':' ? strtoul(next + 1, NULL, 0) : *min;
+    return *max >= *min;
+}
+
+// Cartesian product of the axes on top of the compiled defaults
+static void balance_build_configs(Balance* balance) {
+    balance->config_count = 1;
+    for(int a = 0; a < balance->axis_count; a++) balance->config_count *= balance->axes[a].value_count;
+    balance->configs = calloc(balance->config_count, sizeof(GameTuning));
+    for(uint32_t c = 0; c < balance->config_count; c++) {
+        GameTuning* tuning = &balance->configs[c];
+        *tuning = tuning_default;
+        uint32_t index = c;
+        for(int a = balance->axis_count - 1; a >= 0; a--) {
+            SweepAxis* axis = &balance->axes[a];
+            tuning_set(tuning, axis->field, axis->values[index % axis->value_count]);
+            index /= axis->value_count;
+        }
+    }
+}
+
+// splitmix32-style mix so neighbouring session numbers get unrelated seeds
+static uint32_t balance_mix(uint32_t x) {
+    x += 0x9E3779B9U;
+    x = (x ^ (x >> 16)) * 0x85EBCA6BU;
+    x = (x ^ (x >> 13)) * 0xC2B2AE35U;
+    return x ^ (x >> 16);
+}
+
+// Hit the game does not punish yet: an obstacle crossing the mascot's row in its lane on the ground
+// previous holds the row of each pool id last step, 0 when it was not alive
+static bool balance_flip_zip_hit(const GameContext* ctx, int previous[POOL_SIZE]) {
+    const EntityPool* pool = &ctx->pool;
+    int line = PORTRAIT_HEIGHT - 7 - ctx->mascot_y;
+    bool hit = false;
+    for(int id = 0; id < POOL_SIZE; id++) {
+        int before = previous[id];
+        int after = pool_live(pool, id) ? pool->y[id] : 0;
+        if(pool->lane[id] == ctx->mascot_lane && before > 0 && before < line && (after >= line || after == 0) &&
+           !ctx->is_jumping) {
+            hit = true;
+        }
+        previous[id] = after;
+    }
+    return hit;
+}
+
+static void balance_run_session(Balance* balance, GameContext* ctx, ViewPort* view_port, uint32_t job) {
+    uint32_t config = job / balance->sessions;
+    uint32_t session = job % balance->sessions;
+    SessionResult* result = &balance->results[job];
+    memset(result, 0, sizeof(SessionResult));
+
+    // Same seeds for every config, so sweep points differ only by the tuning
+    uint32_t seed = balance_mix(balance->seed ^ balance_mix(session));
+    uint32_t skill = balance_mix(seed);
+    BotConfig bot_config = {
+        .accuracy_pct = balance->accuracy_min + skill % (balance->accuracy_max - balance->accuracy_min + 1),
+        .latency_ms = balance->latency_min + (skill >> 8) % (balance->latency_max - balance->latency_min + 1),
+        .jitter_ms = balance->jitter_ms,
+        .seed = balance_mix(skill),
+    };
+    result->accuracy_pct = bot_config.accuracy_pct;
+    result->latency_ms = bot_config.latency_ms;
+    if(!session_start(ctx, view_port, balance->game, seed, &balance->configs[config])) return;
+
+    Bot bot;
+    bot_init(&bot, &bot_config);
+    int previous_obstacles[POOL_SIZE] = {0};
+    int last_streak = 0;
+    int last_step_value = balance->game == GAME_STATE_FLIP_ZIP ? ctx->speed_bpm : (int)ctx->difficulty;
+    int last_screen = ctx->screen_type;
+    uint32_t start = furi_get_tick();
+    uint32_t end = start + balance->session_ms;
+    result->fail_ms = balance->session_ms;
+    while((int32_t)(end - furi_get_tick()) > 0 && ctx->state == balance->game) {
+        session_step(ctx, &bot);
+        uint32_t elapsed = furi_get_tick() - start;
+
+        bool fail = false;
+        int step_value = 0;
+        if(balance->game == GAME_STATE_ZERO_HERO) {
+            fail = last_streak > 0 && ctx->streak == 0; // Miss broke the streak
+            last_streak = ctx->streak;
+            step_value = ctx->difficulty;
+        } else if(balance->game == GAME_STATE_FLIP_ZIP) {
+            fail = balance_flip_zip_hit(ctx, previous_obstacles);
+            step_value = ctx->speed_bpm;
+        } else {
+            fail = ctx->screen_type == 8 && last_screen != 8; // Health ran out, dock sequence
+            last_screen = ctx->screen_type;
+        }
+        if(fail) {
+            if(!result->failed) result->fail_ms = elapsed;
+            result->failed = true;
+            result->fails++;
+        }
+        if(step_value > last_step_value) {
+            if(result->steps == 0) result->first_step_ms = elapsed;
+            result->steps++;
+        }
+        last_step_value = step_value;
+    }
+    result->score = bot.report.score;
+    result->max_streak = bot.report.max_streak;
+}
+
+static void* balance_worker(void* context) {
+    Balance* balance = context;
+    GameContext* ctx = malloc(sizeof(GameContext));
+    ViewPort* view_port = view_port_alloc();
+    uint32_t jobs = balance->config_count * balance->sessions;
+    for(uint32_t job = atomic_fetch_add(&balance->next_job, 1); job < jobs; job = atomic_fetch_add(&balance->next_job, 1)) {
+        balance_run_session(balance, ctx, view_port, job);
+    }
+    view_port_free(view_port);
+    free(ctx);
+    return NULL;
+}
+
+static int balance_compare(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+// mean p10 p50 p90 max over count samples, scaled by 1/divisor
+static void balance_print_row(const char* label, uint32_t* samples, uint32_t count, uint32_t divisor) {
+    if(count == 0) {
+        printf("  %-16s %8s\n", label, "-");
+        return;
+    }
+    qsort(samples, count, sizeof(uint32_t), balance_compare);
+    uint64_t sum = 0;
+    for(uint32_t i = 0; i < count; i++) sum += samples[i];
+    printf("  %-16s %8.1f %8.1f %8.1f %8.1f %8.1f\n", label,
+        (double)sum / count / divisor,
+        (double)samples[count / 10] / divisor,
+        (double)samples[count / 2] / divisor,
+        (double)samples[count * 9 / 10] / divisor,
+        (double)samples[count - 1] / divisor);
+}
+
+static void balance_print_config(Balance* balance, uint32_t config, uint32_t* scratch) {
+    const SessionResult* results = &balance->results[config * balance->sessions];
+    uint32_t n = balance->sessions;
+
+    printf("config %lu:", (unsigned long)config);
+    if(balance->axis_count == 0) printf(" defaults");
+    for(int a = 0; a < balance->axis_count; a++) {
+        const TuningField* field = balance->axes[a].field;
+        printf(" %s=%lu", field->name, (unsigned long)tuning_get(&balance->configs[config], field));
+    }
+    uint32_t failed = 0, stepped = 0;
+    for(uint32_t i = 0; i < n; i++) {
+        failed += results[i].failed;
+        stepped += results[i].steps > 0;
+    }
+    printf("\n  failed %lu%%, stepped %lu%%\n", (unsigned long)(failed * 100 / n), (unsigned long)(stepped * 100 / n));
+    printf("  %-16s %8s %8s %8s %8s %8s\n", "", "mean", "p10", "p50", "p90", "max");
+
+    for(uint32_t i = 0; i < n; i++) scratch[i] = results[i].max_streak;
+    balance_print_row("max streak", scratch, n, 1);
+    for(uint32_t i = 0; i < n; i++) scratch[i] = results[i].score;
+    balance_print_row("score", scratch, n, 1);
+    uint32_t count = 0;
+    for(uint32_t i = 0; i < n; i++) {
+        if(results[i].failed) scratch[count++] = results[i].fail_ms;
+    }
+    balance_print_row("time to fail s", scratch, count, 1000);
+    for(uint32_t i = 0; i < n; i++) scratch[i] = results[i].fails;
+    balance_print_row("fails", scratch, n, 1);
+    count = 0;
+    for(uint32_t i = 0; i < n; i++) {
+        if(results[i].steps) scratch[count++] = results[i].first_step_ms;
+    }
+    balance_print_row("first step s", scratch, count, 1000);
+    for(uint32_t i = 0; i < n; i++) scratch[i] = results[i].steps;
+    balance_print_row("steps", scratch, n, 1);
+}
+
+static void balance_write_csv(Balance* balance, const char* path) {
+    FILE* file = fopen(path, "w");
+    if(!file) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return;
+    }
+    fprintf(file, "config,session,accuracy_pct,latency_ms,score,max_streak,failed,fail_ms,fails,first_step_ms,steps\n");
+    for(uint32_t job = 0; job < balance->config_count * balance->sessions; job++) {
+        const SessionResult* r = &balance->results[job];
+        fprintf(file, "%lu,%lu,%u,%u,%d,%d,%d,%lu,%lu,%lu,%lu\n",
+            (unsigned long)(job / balance->sessions), (unsigned long)(job % balance->sessions),
+            r->accuracy_pct, r->latency_ms, r->score, r->max_streak, r->failed,
+            (unsigned long)r->fail_ms, (unsigned long)r->fails, (unsigned long)r->first_step_ms, (unsigned long)r->steps);
+    }
+    fclose(file);
+}
+
+static void balance_usage(const char* name) {
+    fprintf(stderr,
+        "usage: %s zero|zip|flip_iq|space [options]\n"
+        "  -n sessions     per config (1000)\n"
+        "  -m minutes      game time per session (10)\n"
+        "  -j threads      worker threads (all cores)\n"
+        "  -s seed         base seed (1)\n"
+        "  -a min:max      bot accuracy %% range (60:95)\n"
+        "  -l min:max      bot latency ms range (80:250)\n"
+        "  -J ms           bot jitter (60)\n"
+        "  -k name=v1,...  sweep a tuning constant, repeat for a grid\n"
+        "  -c file         per-session CSV\n"
+        "tuning constants:",
+        name);
+    for(size_t i = 0; i < tuning_field_count; i++) {
+        fprintf(stderr, " %s=%lu", tuning_fields[i].name, (unsigned long)tuning_get(&tuning_default, &tuning_fields[i]));
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char** argv) {
+    static Balance balance = {
+        .sessions = 1000,
+        .session_ms = 10 * 60000,
+        .seed = 1,
+        .accuracy_min = 60,
+        .accuracy_max = 95,
+        .latency_min = 80,
+        .latency_max = 250,
+        .jitter_ms = 60,
+    };
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    const char* csv_path = NULL;
+    uint32_t min, max;
+
+    balance.game = argc > 1 ? session_game_from_name(argv[1]) : GAME_STATE_LOADING;
+    if(balance.game == GAME_STATE_LOADING) {
+        balance_usage(argv[0]);
+        return 2;
+    }
+    int option;
+    optind = 2;
+    while((option = getopt(argc, argv, "n:m:j:s:a:l:J:k:c:")) != -1) {
+        bool ok = true;
+        switch(option) {
+        case 'n':
+            balance.sessions = strtoul(optarg, NULL, 0);
+            ok = balance.sessions > 0;
+            break;
+        case 'm':
+            balance.session_ms = (uint32_t)(atof(optarg) * 60000.0);
+            ok = balance.session_ms > 0;
+            break;
+        case 'j':
+            threads = strtol(optarg, NULL, 0);
+            break;
+        case 's':
+            balance.seed = strtoul(optarg, NULL, 0);
+            break;
+        case 'a':
+            ok = balance_parse_range(optarg, &min, &max) && max <= 100;
+            balance.accuracy_min = min;
+            balance.accuracy_max = max;
+            break;
+        case 'l':
+            ok = balance_parse_range(optarg, &min, &max) && max <= UINT16_MAX;
+            balance.latency_min = min;
+            balance.latency_max = max;
+            break;
+        case 'J':
+            balance.jitter_ms = strtoul(optarg, NULL, 0);
+            break;
+        case 'k':
+            ok = balance_parse_axis(&balance, optarg);
+            break;
+        case 'c':
+            csv_path = optarg;
+            break;
+        default:
+            ok = false;
+        }
+        if(!ok) {
+            balance_usage(argv[0]);
+            return 2;
+        }
+    }
+    if(threads < 1) threads = 1;
+
+    animations_init(); // Baked tables are shared read-only by every worker
+    balance_build_configs(&balance);
+    uint32_t jobs = balance.config_count * balance.sessions;
+    balance.results = calloc(jobs, sizeof(SessionResult));
+    pthread_t* workers = calloc(threads, sizeof(pthread_t));
+    uint32_t* scratch = calloc(balance.sessions, sizeof(uint32_t));
+    if(!balance.configs || !balance.results || !workers || !scratch) return 1;
+
+    struct timespec wall_start, wall_end;
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+    for(long i = 0; i < threads; i++) pthread_create(&workers[i], NULL, balance_worker, &balance);
+    for(long i = 0; i < threads; i++) pthread_join(workers[i], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+    double wall = (wall_end.tv_sec - wall_start.tv_sec) + (wall_end.tv_nsec - wall_start.tv_nsec) / 1e9;
+
+    printf("%s: %lu configs x %lu sessions of %.1f min, accuracy %u-%u%%, latency %u-%ums, %ld threads, %.2fs\n",
+        session_game_name(balance.game), (unsigned long)balance.config_count, (unsigned long)balance.sessions,
+        balance.session_ms / 60000.0, balance.accuracy_min, balance.accuracy_max, balance.latency_min,
+        balance.latency_max, threads, wall);
+    for(uint32_t c = 0; c < balance.config_count; c++) balance_print_config(&balance, c, scratch);
+    if(csv_path) balance_write_csv(&balance, csv_path);
+
+    free(scratch);
+    free(workers);
+    free(balance.results);
+    free(balance.configs);
+    return 0;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+// Host stand-in for the parts of furi the game uses. Time is virtual and per
+// thread (see host_furi.h), so runs are fast and repeatable.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define UNUSED(x) (void)(x)
+#define COUNT_OF(x) (sizeof(x) / sizeof(x[0]))
+#define furi_assert(x) ((void)(x))
+#define furi_check(x) ((void)(x))
+#define FuriWaitForever 0xFFFFFFFFU
+
+#define FURI_LOG_E(tag, fmt, ...) fprintf(stderr, "[E][%s] " fmt "\n", tag, ##__VA_ARGS__)
+#define FURI_LOG_W(tag, fmt, ...) fprintf(stderr, "[W][%s] " fmt "\n", tag, ##__VA_ARGS__)
+#define FURI_LOG_I(tag, fmt, ...) fprintf(stderr, "[I][%s] " fmt "\n", tag, ##__VA_ARGS__)
+#define FURI_LOG_D(tag, fmt, ...) ((void)(tag))
+
+typedef enum {
+    FuriStatusOk = 0,
+    FuriStatusError = -1,
+    FuriStatusErrorTimeout = -2,
+    FuriStatusErrorResource = -3,
+} FuriStatus;
+
+uint32_t furi_get_tick(void);
+void furi_delay_ms(uint32_t ms);
+
+typedef enum {
+    FuriTimerTypeOnce,
+    FuriTimerTypePeriodic,
+} FuriTimerType;
+
+typedef struct FuriTimer FuriTimer;
+typedef void (*FuriTimerCallback)(void* context);
+
+FuriTimer* furi_timer_alloc(FuriTimerCallback callback, FuriTimerType type, void* context);
+FuriStatus furi_timer_start(FuriTimer* timer, uint32_t ticks);
+FuriStatus furi_timer_stop(FuriTimer* timer);
+void furi_timer_free(FuriTimer* timer);
+
+void* furi_record_open(const char* name);
+void furi_record_close(const char* name);
+
+// Threads, mutexes and thread flags on pthreads, for the speech worker
+typedef struct FuriThread FuriThread;
+typedef FuriThread* FuriThreadId;
+typedef int32_t (*FuriThreadCallback)(void* context);
+
+typedef enum {
+    FuriThreadPriorityLow = 15,
+    FuriThreadPriorityNormal = 16,
+} FuriThreadPriority;
+
+#define FuriFlagWaitAny 0x00000000U
+
+FuriThread* furi_thread_alloc_ex(const char* name, uint32_t stack_size, FuriThreadCallback callback, void* context);
+void furi_thread_free(FuriThread* thread);
+void furi_thread_set_priority(FuriThread* thread, FuriThreadPriority priority);
+void furi_thread_start(FuriThread* thread);
+bool furi_thread_join(FuriThread* thread);
+FuriThreadId furi_thread_get_id(FuriThread* thread);
+FuriThreadId furi_thread_get_current_id(void); // NULL outside a FuriThread
+uint32_t furi_thread_flags_set(FuriThreadId thread_id, uint32_t flags);
+uint32_t furi_thread_flags_wait(uint32_t flags, uint32_t options, uint32_t timeout);
+
+typedef enum {
+    FuriMutexTypeNormal,
+} FuriMutexType;
+
+typedef struct FuriMutex FuriMutex;
+
+FuriMutex* furi_mutex_alloc(FuriMutexType type);
+void furi_mutex_free(FuriMutex* mutex);
+FuriStatus furi_mutex_acquire(FuriMutex* mutex, uint32_t timeout);
+FuriStatus furi_mutex_release(FuriMutex* mutex);
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <furi.h>
+#include <furi_hal_speaker.h>
+#include <furi_hal_vibro.h>
+
+uint32_t furi_hal_cortex_instructions_per_microsecond(void);
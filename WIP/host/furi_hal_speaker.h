@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+bool furi_hal_speaker_is_mine(void);
+bool furi_hal_speaker_acquire(uint32_t timeout);
+void furi_hal_speaker_release(void);
+void furi_hal_speaker_start(float frequency, float volume);
+void furi_hal_speaker_set_volume(float volume);
+void furi_hal_speaker_stop(void);
@@ -0,0 +1,5 @@
+#pragma once
+
+#include <stdbool.h>
+
+void furi_hal_vibro_on(bool value);
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <input/input.h>
+
+typedef struct Canvas Canvas;
+typedef struct Gui Gui;
+typedef struct ViewPort ViewPort;
+
+typedef enum {
+    ColorWhite = 0,
+    ColorBlack = 1,
+    ColorXOR = 2,
+} Color;
+
+typedef enum {
+    FontPrimary,
+    FontSecondary,
+    FontKeyboard,
+    FontBigNumbers,
+    FontTotalNumber,
+} Font;
+
+typedef enum {
+    GuiLayerFullscreen = 4,
+} GuiLayer;
+
+typedef enum {
+    ViewPortOrientationHorizontal,
+    ViewPortOrientationHorizontalFlip,
+    ViewPortOrientationVertical,
+    ViewPortOrientationVerticalFlip,
+} ViewPortOrientation;
+
+#define RECORD_GUI "gui"
+
+typedef void (*ViewPortDrawCallback)(Canvas* canvas, void* context);
+typedef void (*ViewPortInputCallback)(InputEvent* event, void* context);
+
+ViewPort* view_port_alloc(void);
+void view_port_free(ViewPort* view_port);
+void view_port_draw_callback_set(ViewPort* view_port, ViewPortDrawCallback callback, void* context);
+void view_port_input_callback_set(ViewPort* view_port, ViewPortInputCallback callback, void* context);
+void view_port_set_orientation(ViewPort* view_port, ViewPortOrientation orientation);
+void view_port_update(ViewPort* view_port);
+void gui_add_view_port(Gui* gui, ViewPort* view_port, GuiLayer layer);
+void gui_remove_view_port(Gui* gui, ViewPort* view_port);
+
+// Host canvas only counts calls; nothing is rasterised
+Canvas* host_canvas_get(void);
+
+void canvas_clear(Canvas* canvas);
+void canvas_set_color(Canvas* canvas, Color color);
+void canvas_set_font(Canvas* canvas, Font font);
+void canvas_draw_box(Canvas* canvas, int32_t x, int32_t y, size_t width, size_t height);
+void canvas_draw_frame(Canvas* canvas, int32_t x, int32_t y, size_t width, size_t height);
+void canvas_draw_line(Canvas* canvas, int32_t x1, int32_t y1, int32_t x2, int32_t y2);
+void canvas_draw_str(Canvas* canvas, int32_t x, int32_t y, const char* str);
+void canvas_draw_circle(Canvas* canvas, int32_t x, int32_t y, size_t radius);
+void canvas_draw_disc(Canvas* canvas, int32_t x, int32_t y, size_t radius);
+void canvas_draw_dot(Canvas* canvas, int32_t x, int32_t y);
+uint16_t canvas_string_width(Canvas* canvas, const char* str);
@@ -0,0 +1,400 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include <gui/gui.h>
+#include <storage/storage.h>
+#include "host_furi.h"
+#include "stm32_sam.h"
+
+#include <pthread.h>
+
+struct Canvas {
+    uint32_t ops;
+    Color color;
+    Font font;
+};
+
+struct ViewPort {
+    ViewPortDrawCallback draw;
+    void* draw_context;
+    ViewPortInputCallback input;
+    void* input_context;
+    ViewPortOrientation orientation;
+};
+
+struct FuriTimer {
+    FuriTimerCallback callback;
+    void* context;
+};
+
+struct FuriThread {
+    pthread_t handle;
+    FuriThreadCallback callback;
+    void* context;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    uint32_t flags;
+};
+
+struct FuriMutex {
+    pthread_mutex_t handle;
+};
+
+struct File {
+    FILE* handle;
+};
+
+static _Thread_local uint32_t host_tick;
+static _Thread_local FuriThread* host_thread_current;
+static _Thread_local Canvas host_canvas;
+
+void host_tick_set(uint32_t ms) {
+    host_tick = ms;
+}
+
+void host_tick_advance(uint32_t ms) {
+    host_tick += ms;
+}
+
+uint32_t host_canvas_ops(void) {
+    return host_canvas.ops;
+}
+
+void host_canvas_reset(void) {
+    host_canvas.ops = 0;
+}
+
+Canvas* host_canvas_get(void) {
+    return &host_canvas;
+}
+
+uint32_t furi_get_tick(void) {
+    return host_tick;
+}
+
+// Blocking waits in the game cost virtual time only
+void furi_delay_ms(uint32_t ms) {
+    host_tick += ms;
+}
+
+FuriTimer* furi_timer_alloc(FuriTimerCallback callback, FuriTimerType type, void* context) {
+    UNUSED(type);
+    FuriTimer* timer = calloc(1, sizeof(FuriTimer));
+    if(!timer) return NULL;
+    timer->callback = callback;
+    timer->context = context;
+    return timer;
+}
+
+FuriStatus furi_timer_start(FuriTimer* timer, uint32_t ticks) {
+    UNUSED(timer);
+    UNUSED(ticks);
+    return FuriStatusOk;
+}
+
+FuriStatus furi_timer_stop(FuriTimer* timer) {
+    UNUSED(timer);
+    return FuriStatusOk;
+}
+
+void furi_timer_free(FuriTimer* timer) {
+    free(timer);
+}
+
+void* furi_record_open(const char* name) {
+    static int record;
+    UNUSED(name);
+    return &record;
+}
+
+void furi_record_close(const char* name) {
+    UNUSED(name);
+}
+
+uint32_t furi_hal_cortex_instructions_per_microsecond(void) {
+    return 64;
+}
+
+bool furi_hal_speaker_is_mine(void) {
+    return false;
+}
+
+bool furi_hal_speaker_acquire(uint32_t timeout) {
+    UNUSED(timeout);
+    return true;
+}
+
+void furi_hal_speaker_release(void) {
+}
+
+void furi_hal_speaker_start(float frequency, float volume) {
+    UNUSED(frequency);
+    UNUSED(volume);
+}
+
+void furi_hal_speaker_set_volume(float volume) {
+    UNUSED(volume);
+}
+
+void furi_hal_speaker_stop(void) {
+}
+
+void furi_hal_vibro_on(bool value) {
+    UNUSED(value);
+}
+
+void sam_init(STM32SAM* sam) {
+    UNUSED(sam);
+}
+
+void sam_say(STM32SAM* sam, const char* text) {
+    UNUSED(sam);
+    UNUSED(text);
+}
+
+ViewPort* view_port_alloc(void) {
+    return calloc(1, sizeof(ViewPort));
+}
+
+void view_port_free(ViewPort* view_port) {
+    free(view_port);
+}
+
+void view_port_draw_callback_set(ViewPort* view_port, ViewPortDrawCallback callback, void* context) {
+    view_port->draw = callback;
+    view_port->draw_context = context;
+}
+
+void view_port_input_callback_set(ViewPort* view_port, ViewPortInputCallback callback, void* context) {
+    view_port->input = callback;
+    view_port->input_context = context;
+}
+
+void view_port_set_orientation(ViewPort* view_port, ViewPortOrientation orientation) {
+    view_port->orientation = orientation;
+}
+
+void view_port_update(ViewPort* view_port) {
+    UNUSED(view_port);
+}
+
+void gui_add_view_port(Gui* gui, ViewPort* view_port, GuiLayer layer) {
+    UNUSED(gui);
+    UNUSED(view_port);
+    UNUSED(layer);
+}
+
+void gui_remove_view_port(Gui* gui, ViewPort* view_port) {
+    UNUSED(gui);
+    UNUSED(view_port);
+}
+
+void canvas_clear(Canvas* canvas) {
+    canvas->ops++;
+}
+
+void canvas_set_color(Canvas* canvas, Color color) {
+    canvas->color = color;
+}
+
+void canvas_set_font(Canvas* canvas, Font font) {
+    canvas->font = font;
+}
+
+void canvas_draw_box(Canvas* canvas, int32_t x, int32_t y, size_t width, size_t height) {
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(width);
+    UNUSED(height);
+    canvas->ops++;
+}
+
+void canvas_draw_frame(Canvas* canvas, int32_t x, int32_t y, size_t width, size_t height) {
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(width);
+    UNUSED(height);
+    canvas->ops++;
+}
+
+void canvas_draw_line(Canvas* canvas, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    UNUSED(x1);
+    UNUSED(y1);
+    UNUSED(x2);
+    UNUSED(y2);
+    canvas->ops++;
+}
+
+void canvas_draw_str(Canvas* canvas, int32_t x, int32_t y, const char* str) {
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(str);
+    canvas->ops++;
+}
+
+void canvas_draw_circle(Canvas* canvas, int32_t x, int32_t y, size_t radius) {
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(radius);
+    canvas->ops++;
+}
+
+void canvas_draw_disc(Canvas* canvas, int32_t x, int32_t y, size_t radius) {
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(radius);
+    canvas->ops++;
+}
+
+void canvas_draw_dot(Canvas* canvas, int32_t x, int32_t y) {
+    UNUSED(x);
+    UNUSED(y);
+    canvas->ops++;
+}
+
+// Rough widths of the stock fonts, close enough for layout checks
+uint16_t canvas_string_width(Canvas* canvas, const char* str) {
+    uint16_t advance = canvas->font == FontPrimary ? 7 : 6;
+    uint16_t width = 0;
+    while(*str++) width += advance;
+    return width;
+}
+
+static void* host_thread_main(void* arg) {
+    FuriThread* thread = arg;
+    host_thread_current = thread;
+    thread->callback(thread->context);
+    return NULL;
+}
+
+FuriThread* furi_thread_alloc_ex(const char* name, uint32_t stack_size, FuriThreadCallback callback, void* context) {
+    UNUSED(name);
+    UNUSED(stack_size);
+    FuriThread* thread = calloc(1, sizeof(FuriThread));
+    thread->callback = callback;
+    thread->context = context;
+    pthread_mutex_init(&thread->lock, NULL);
+    pthread_cond_init(&thread->wake, NULL);
+    return thread;
+}
+
+void furi_thread_free(FuriThread* thread) {
+    pthread_cond_destroy(&thread->wake);
+    pthread_mutex_destroy(&thread->lock);
+    free(thread);
+}
+
+void furi_thread_set_priority(FuriThread* thread, FuriThreadPriority priority) {
+    UNUSED(thread);
+    UNUSED(priority);
+}
+
+void furi_thread_start(FuriThread* thread) {
+    pthread_create(&thread->handle, NULL, host_thread_main, thread);
+}
+
+bool furi_thread_join(FuriThread* thread) {
+    return pthread_join(thread->handle, NULL) == 0;
+}
+
+FuriThreadId furi_thread_get_id(FuriThread* thread) {
+    return thread;
+}
+
+FuriThreadId furi_thread_get_current_id(void) {
+    return host_thread_current;
+}
+
+uint32_t furi_thread_flags_set(FuriThreadId thread_id, uint32_t flags) {
+    pthread_mutex_lock(&thread_id->lock);
+    thread_id->flags |= flags;
+    uint32_t set = thread_id->flags;
+    pthread_cond_signal(&thread_id->wake);
+    pthread_mutex_unlock(&thread_id->lock);
+    return set;
+}
+
+// Only FuriWaitForever is needed so far
+uint32_t furi_thread_flags_wait(uint32_t flags, uint32_t options, uint32_t timeout) {
+    UNUSED(options);
+    UNUSED(timeout);
+    FuriThread* thread = host_thread_current;
+    pthread_mutex_lock(&thread->lock);
+    while(!(thread->flags & flags)) pthread_cond_wait(&thread->wake, &thread->lock);
+    uint32_t set = thread->flags & flags;
+    thread->flags &= ~flags;
+    pthread_mutex_unlock(&thread->lock);
+    return set;
+}
+
+FuriMutex* furi_mutex_alloc(FuriMutexType type) {
+    UNUSED(type);
+    FuriMutex* mutex = calloc(1, sizeof(FuriMutex));
+    pthread_mutex_init(&mutex->handle, NULL);
+    return mutex;
+}
+
+void furi_mutex_free(FuriMutex* mutex) {
+    pthread_mutex_destroy(&mutex->handle);
+    free(mutex);
+}
+
+FuriStatus furi_mutex_acquire(FuriMutex* mutex, uint32_t timeout) {
+    if(timeout == FuriWaitForever) {
+        return pthread_mutex_lock(&mutex->handle) == 0 ? FuriStatusOk : FuriStatusError;
+    }
+    return pthread_mutex_trylock(&mutex->handle) == 0 ? FuriStatusOk : FuriStatusErrorTimeout;
+}
+
+FuriStatus furi_mutex_release(FuriMutex* mutex) {
+    return pthread_mutex_unlock(&mutex->handle) == 0 ? FuriStatusOk : FuriStatusError;
+}
+
+File* storage_file_alloc(Storage* storage) {
+    UNUSED(storage);
+    return calloc(1, sizeof(File));
+}
+
+void storage_file_free(File* file) {
+    free(file);
+}
+
+bool storage_file_open(File* file, const char* path, FS_AccessMode access_mode, FS_OpenMode open_mode) {
+    const char* mode = open_mode == FSOM_OPEN_APPEND  ? "ab" :
+                       open_mode == FSOM_CREATE_ALWAYS ? (access_mode & FSAM_READ ? "w+b" : "wb") :
+                       access_mode & FSAM_WRITE        ? "r+b" :
+                                                         "rb";
+    file->handle = fopen(path, mode);
+    return file->handle != NULL;
+}
+
+bool storage_file_close(File* file) {
+    bool closed = file->handle && fclose(file->handle) == 0;
+    file->handle = NULL;
+    return closed;
+}
+
+size_t storage_file_read(File* file, void* buff, size_t bytes_to_read) {
+    return file->handle ? fread(buff, 1, bytes_to_read, file->handle) : 0;
+}
+
+size_t storage_file_write(File* file, const void* buff, size_t bytes_to_write) {
+    return file->handle ? fwrite(buff, 1, bytes_to_write, file->handle) : 0;
+}
+
+bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
+    return file->handle && fseek(file->handle, offset, from_start ? SEEK_SET : SEEK_CUR) == 0;
+}
+
+bool storage_file_sync(File* file) {
+    return file->handle && fflush(file->handle) == 0;
+}
+
+FS_Error storage_common_rename(Storage* storage, const char* old_path, const char* new_path) {
+    UNUSED(storage);
+    return rename(old_path, new_path) == 0 ? FSE_OK : FSE_INTERNAL;
+}
+
+FS_Error storage_common_remove(Storage* storage, const char* path) {
+    UNUSED(storage);
+    return remove(path) == 0 ? FSE_OK : FSE_NOT_EXIST;
+}
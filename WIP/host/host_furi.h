@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdint.h>
+
+// Virtual clock behind furi_get_tick()/furi_delay_ms(), one per thread
+void host_tick_set(uint32_t ms);
+void host_tick_advance(uint32_t ms);
+
+// Draw calls made on the host canvas since the last reset
+uint32_t host_canvas_ops(void);
+void host_canvas_reset(void);
@@ -0,0 +1,82 @@
+// Packs pre-rendered phrases into the ADPCM asset the speech worker streams
+// from. Inputs are raw unsigned 8-bit mono PCM, one file per TtsPhrase in ID
+// order; "-" leaves a phrase out so SAM keeps saying it live. See Readme.md.
+
+#include "nah2nah3_pcm.h"
+#include "nah2nah3_tts.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint8_t* pack_read(const char* path, uint32_t* samples) {
+    FILE* file = fopen(path, "rb");
+    if(!file) return NULL;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t* pcm = size > 0 ? malloc(size) : NULL;
+    if(pcm && fread(pcm, 1, size, file) != (size_t)size) {
+        free(pcm);
+        pcm = NULL;
+    }
+    fclose(file);
+    *samples = pcm ? (uint32_t)size : 0;
+    return pcm;
+}
+
+int main(int argc, char** argv) {
+    int count = argc - 3;
+    if(count < 1 || count > TTS_PHRASE_COUNT) {
+        fprintf(stderr, "usage: %s out.pcm sample_rate phrase0.raw|- ...\nphrases:\n", argv[0]);
+        for(int i = 0; i < TTS_PHRASE_COUNT; i++) fprintf(stderr, "  %2d %s\n", i, tts_phrases[i]);
+        return 2;
+    }
+    PcmHeader header = {PCM_MAGIC, PCM_VERSION, (uint8_t)count, (uint16_t)atoi(argv[2])};
+    PcmPhraseIndex index[TTS_PHRASE_COUNT];
+    memset(index, 0, sizeof(index));
+    uint8_t* packed[TTS_PHRASE_COUNT] = {0};
+    uint32_t offset = sizeof(header) + count * sizeof(PcmPhraseIndex);
+    uint32_t total_samples = 0;
+
+    for(int i = 0; i < count; i++) {
+        const char* path = argv[3 + i];
+        if(strcmp(path, "-") == 0) continue;
+        uint32_t samples;
+        uint8_t* pcm = pack_read(path, &samples);
+        if(!pcm) {
+            fprintf(stderr, "%s: cannot read\n", path);
+            return 1;
+        }
+        // Start the decoder on the first sample so the phrase does not click in
+        PcmState state = {(int16_t)(((int32_t)pcm[0] - 128) << 8), 0};
+        index[i] = (PcmPhraseIndex){offset, samples, state.predictor, state.step_index, 0};
+        packed[i] = calloc(PCM_ADPCM_BYTES(samples), 1);
+        for(uint32_t s = 0; s < samples; s++) {
+            uint8_t nibble = pcm_adpcm_encode(&state, pcm[s]);
+            packed[i][s / 2] |= (s & 1) ? nibble << 4 : nibble;
+        }
+        offset += PCM_ADPCM_BYTES(samples);
+        total_samples += samples;
+        free(pcm);
+        if(PCM_ADPCM_BYTES(samples) > PCM_CACHE_BYTES) {
+            fprintf(stderr, "%s: %u bytes packed, over the %u byte cache, SAM will say it\n", path,
+                (unsigned)PCM_ADPCM_BYTES(samples), (unsigned)PCM_CACHE_BYTES);
+        }
+    }
+
+    FILE* out = fopen(argv[1], "wb");
+    if(!out) {
+        fprintf(stderr, "%s: cannot write\n", argv[1]);
+        return 1;
+    }
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(index, sizeof(PcmPhraseIndex), count, out);
+    for(int i = 0; i < count; i++) {
+        if(packed[i]) fwrite(packed[i], 1, PCM_ADPCM_BYTES(index[i].samples), out);
+        free(packed[i]);
+    }
+    fclose(out);
+    printf("%d phrases, %u samples, %u bytes\n", count, (unsigned)total_samples, (unsigned)offset);
+    return 0;
+}
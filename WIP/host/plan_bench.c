@@ -0,0 +1,101 @@
+// Flip Zip row planner benchmark: the bot plays with the speed pinned while
+// each tick times the planner on the live screen, for a grid of spawn
+// intervals and speeds. See Readme.md for the build line.
+
+#include "../nah2nah3.c"
+#include "session.h"
+
+#define PLAN_BENCH_REPEAT 64 // Calls per sample, the host clock is too coarse for one
+
+static const uint8_t plan_bench_spawn_ticks[] = {15, 8, 4, 2, 1};
+static const uint8_t plan_bench_speeds[] = {0, 60, 120, 250};
+
+static int plan_bench_compare(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+static int plan_bench_bits(uint8_t row) {
+    int bits = 0;
+    for(; row; row &= row - 1) bits++;
+    return bits;
+}
+
+int main(int argc, char** argv) {
+    double minutes = argc > 1 ? atof(argv[1]) : 10.0;
+    uint32_t seed = argc > 2 ? strtoul(argv[2], NULL, 0) : 1;
+    GameState game = GAME_STATE_FLIP_ZIP;
+    uint32_t sample_max = (uint32_t)(minutes * 60000.0) / (1000 / FPS_BASE) + 1; // One sample per timer tick
+    uint32_t* sample_ns = malloc(sample_max * sizeof(uint32_t));
+    if(!sample_ns) return 1;
+
+    static GameContext game_context;
+    GameContext* ctx = &game_context;
+    ViewPort* view_port = view_port_alloc();
+    animations_init();
+    printf("%s planner, %g min per point\n", session_game_name(game), minutes);
+    printf("spawn  bpm  walls   samples  full%%  placed  thinned%%  ns avg  ns p99\n");
+    for(size_t s = 0; s < sizeof(plan_bench_spawn_ticks); s++) {
+        for(size_t v = 0; v < sizeof(plan_bench_speeds); v++) {
+            GameTuning tuning = tuning_default;
+            tuning.obstacle_spawn_ticks = plan_bench_spawn_ticks[s];
+            tuning.speed_max_bpm = 250;
+            tuning.speed_step_bpm = 0; // Pinned below as well, lane taps add their own 10
+            if(!session_start(ctx, view_port, game, seed, &tuning)) {
+                fprintf(stderr, "could not reach Flip Zip from the title menu\n");
+                return 1;
+            }
+            BotConfig config = {
+                .accuracy_pct = NAH_BOT_ACCURACY,
+                .latency_ms = NAH_BOT_LATENCY_MS,
+                .jitter_ms = NAH_BOT_JITTER_MS,
+                .seed = seed,
+            };
+            Bot bot;
+            bot_init(&bot, &config);
+
+            int speed = plan_bench_speeds[v];
+            int walls = 1 + speed / FLIP_ZIP_WALL_BPM;
+            if(walls > PLAN_LANES - 1) walls = PLAN_LANES - 1;
+            uint32_t samples = 0, full = 0;
+            uint64_t placed = 0, thinned = 0, total_ns = 0;
+            uint32_t end = furi_get_tick() + (uint32_t)(minutes * 60000.0);
+            while((int32_t)(end - furi_get_tick()) > 0 && ctx->state == game && samples < sample_max) {
+                ctx->speed_bpm = speed;
+                int room = 0; // Lanes under the cap; fewer than walls thins the row whatever the plan
+                for(int lane = 0; lane < 5; lane++) room += ctx->pool.lane_count[lane] < game_cap(ctx, LANE_OBJ_LIMIT);
+                int speed_modifier = 1 + fx_to_int(fx_ratio(ctx->speed_bpm, FX_RECIP32(FLIP_ZIP_BASE_BPM)));
+                uint8_t row = 0;
+                uint32_t start = perf_clock();
+                for(int i = 0; i < PLAN_BENCH_REPEAT; i++) {
+                    row = flip_zip_plan_row(ctx, speed_modifier, walls, samples + i);
+                }
+                uint32_t ns = (perf_clock() - start) / PLAN_BENCH_REPEAT;
+                sample_ns[samples++] = ns;
+                total_ns += ns;
+                placed += plan_bench_bits(row);
+                if(room < walls) {
+                    full++;
+                } else if(plan_bench_bits(row) < walls) {
+                    thinned++;
+                }
+                session_step(ctx, &bot);
+            }
+            qsort(sample_ns, samples, sizeof(uint32_t), plan_bench_compare);
+            uint32_t open = samples - full;
+            printf(
+                "%5d  %3d  %5d  %8lu  %5.1f  %6.2f  %8.1f  %6.0f  %6lu\n",
+                tuning.obstacle_spawn_ticks,
+                speed,
+                walls,
+                (unsigned long)samples,
+                samples ? 100.0 * full / samples : 0.0,
+                samples ? (double)placed / samples : 0.0,
+                open ? 100.0 * thinned / open : 0.0,
+                samples ? (double)total_ns / samples : 0.0,
+                samples ? (unsigned long)sample_ns[samples * 99 / 100] : 0UL);
+        }
+    }
+    free(sample_ns);
+    return 0;
+}
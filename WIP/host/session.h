@@ -0,0 +1,68 @@
+#pragma once
+
+// Helpers shared by the host tools. Include after ../nah2nah3.c; they drive
+// its static callbacks directly.
+
+#include "host_furi.h"
+#include "nah2nah3_bot.h"
+
+#include <string.h>
+
+#define SESSION_TICK_MS(ctx) (1000 / (ctx)->tuning.fps_base) // One timer period
+
+static inline void session_tap(GameContext* ctx, InputKey key) {
+    InputEvent press = {.key = key, .type = InputTypePress};
+    InputEvent short_press = {.key = key, .type = InputTypeShort};
+    InputEvent release = {.key = key, .type = InputTypeRelease};
+    input_callback(&press, ctx);
+    input_callback(&short_press, ctx);
+    input_callback(&release, ctx);
+    host_tick_advance(TAP_DRM_MS);
+}
+
+// "zero", "zip", "flip_iq" or "space", GAME_STATE_LOADING if unknown
+static inline GameState session_game_from_name(const char* name) {
+    if(strcmp(name, "zero") == 0) return GAME_STATE_ZERO_HERO;
+    if(strcmp(name, "zip") == 0) return GAME_STATE_FLIP_ZIP;
+    if(strcmp(name, "flip_iq") == 0) return GAME_STATE_FLIP_IQ;
+    if(strcmp(name, "space") == 0) return GAME_STATE_SPACE_FLIGHT;
+    return GAME_STATE_LOADING;
+}
+
+static inline const char* session_game_name(GameState game) {
+    return game == GAME_STATE_FLIP_ZIP     ? "flip_zip" :
+           game == GAME_STATE_FLIP_IQ      ? "flip_iq" :
+           game == GAME_STATE_SPACE_FLIGHT ? "space_flight" :
+                                             "zero_hero";
+}
+
+// Fresh context walked loading -> title -> rotate -> game the way a player would
+static inline bool session_start(GameContext* ctx, ViewPort* view_port, GameState game, uint32_t seed, const GameTuning* tuning) {
+    host_tick_set(1);
+    game_context_init(ctx);
+    game_seed(ctx, seed);
+    if(tuning) ctx->tuning = *tuning;
+    ctx->view_port = view_port;
+
+    host_tick_advance(LOADING_MS);
+    update_loading(ctx);
+    if(ctx->state != GAME_STATE_TITLE) return false;
+    int entry = 0; // Menu is two games per row, only the games built in
+    while(entry < MENU_COUNT && GAME_MODE_STATE(menu_entries[entry].mode) != game) entry++;
+    if(entry == MENU_COUNT) return false;
+    for(int row = 0; row < entry / 2; row++) session_tap(ctx, InputKeyDown);
+    if(entry % 2) session_tap(ctx, InputKeyRight);
+    session_tap(ctx, InputKeyOk);
+    session_tap(ctx, InputKeyOk); // Any press skips the rotate prompt
+    return ctx->state == game;
+}
+
+// One timer period: bot input, game update, then the clock moves on
+static inline void session_step(GameContext* ctx, Bot* bot) {
+    uint32_t now = furi_get_tick();
+    bot_tick(bot, ctx, now, input_callback, ctx);
+    timer_callback(ctx);
+    bot_report_update(bot, ctx);
+    // Game code may have slept; the clock only moves forward from here
+    if(furi_get_tick() == now) host_tick_advance(SESSION_TICK_MS(ctx));
+}
@@ -0,0 +1,152 @@
+// Headless soak run: the bot plays one game on a virtual clock for
+// hours of game time and reports score, best streak, worst tick/draw times and
+// any state that went out of range. See Readme.md for the build line.
+
+#include "../nah2nah3.c"
+#include "session.h"
+
+#define SOAK_SUSPEND_AT_MS 20000 // Play before the suspend check pauses
+#define SOAK_RESUMED_MS 60000 // Play after it resumes
+
+static int soak_violations;
+static int soak_game_overs; // Flip IQ rounds that ended on the title screen
+
+static void soak_report(const char* problem, const GameContext* ctx, uint32_t now) {
+    if(soak_violations++ < 10) {
+        fprintf(stderr, "t=%lus: %s (state %d)\n", (unsigned long)(now / 1000), problem, ctx->state);
+    }
+}
+
+// Flip IQ ends on the title screen; pick it again from the same menu entry
+static void soak_replay(GameContext* ctx, GameState game, uint32_t now) {
+    soak_game_overs++;
+    for(int tap = 0; tap < 2 && ctx->state != game; tap++) session_tap(ctx, InputKeyOk); // Title, then the rotate prompt
+    if(ctx->state != game) soak_report("could not start again from the title", ctx, now);
+}
+
+static void soak_check(const GameContext* ctx, GameState game, uint32_t now) {
+    const char* problem = NULL;
+    if(ctx->state != game) {
+        problem = "left the game";
+    } else if(ctx->speed_bpm < 0 || ctx->speed_bpm > ctx->tuning.speed_max_bpm) {
+        problem = "speed_bpm out of range";
+    } else if(ctx->mascot_lane < 0 || ctx->mascot_lane > 4) {
+        problem = "mascot_lane out of range";
+    } else if(ctx->streak < 0 || ctx->score < 0) {
+        problem = "negative streak or score";
+    }
+    if(problem) soak_report(problem, ctx, now);
+}
+
+// Play the same seed twice, pausing at the same tick. The second run suspends
+// there and resumes into a wiped context, as a relaunch would; both runs must
+// end alike. "skipped" when the game was over before the pause.
+static const char* soak_suspend_check(GameState game, const BotConfig* config, ViewPort* view_port) {
+    static GameContext runs[2];
+    for(int run = 0; run < 2; run++) {
+        GameContext* ctx = &runs[run];
+        if(!session_start(ctx, view_port, game, config->seed, NULL)) return "skipped";
+        Bot bot;
+        bot_init(&bot, config);
+        uint32_t pause = furi_get_tick() + SOAK_SUSPEND_AT_MS;
+        while((int32_t)(pause - furi_get_tick()) > 0) session_step(ctx, &bot);
+        if(ctx->state != game) return "skipped";
+        session_tap(ctx, InputKeyBack);
+        if(run == 1) {
+            uint32_t now = furi_get_tick();
+            bool saved = game_suspend(ctx, now);
+            game_context_init(ctx);
+            game_seed(ctx, ~config->seed); // A relaunch seeds from the clock
+            ctx->view_port = view_port;
+            if(!saved || !game_resume(ctx, now)) {
+                soak_report("could not suspend and resume", ctx, now);
+                return "failed";
+            }
+        }
+        session_tap(ctx, InputKeyOk);
+        uint32_t end = furi_get_tick() + SOAK_RESUMED_MS;
+        while((int32_t)(end - furi_get_tick()) > 0) session_step(ctx, &bot);
+    }
+    const GameContext* plain = &runs[0];
+    const GameContext* resumed = &runs[1];
+    if(plain->state != resumed->state || plain->score != resumed->score || plain->streak != resumed->streak ||
+       plain->rng != resumed->rng || plain->pool.count != resumed->pool.count) {
+        soak_report("resumed game played out differently", resumed, furi_get_tick());
+        return "differs";
+    }
+    return "matches";
+}
+
+int main(int argc, char** argv) {
+    GameState game = argc > 1 ? session_game_from_name(argv[1]) : GAME_STATE_LOADING;
+    if(game == GAME_STATE_LOADING) {
+        fprintf(stderr, "usage: %s zero|zip|flip_iq|space [hours] [accuracy%%] [latency_ms] [jitter_ms] [seed]\n", argv[0]);
+        return 2;
+    }
+    double hours = argc > 2 ? atof(argv[2]) : 1.0;
+    BotConfig config = {
+        .accuracy_pct = argc > 3 ? atoi(argv[3]) : NAH_BOT_ACCURACY,
+        .latency_ms = argc > 4 ? atoi(argv[4]) : NAH_BOT_LATENCY_MS,
+        .jitter_ms = argc > 5 ? atoi(argv[5]) : NAH_BOT_JITTER_MS,
+        .seed = argc > 6 ? strtoul(argv[6], NULL, 0) : 1,
+    };
+
+    static GameContext game_context;
+    GameContext* ctx = &game_context;
+    ViewPort* view_port = view_port_alloc();
+    animations_init();
+    const char* resume = soak_suspend_check(game, &config, view_port);
+    if(!session_start(ctx, view_port, game, config.seed, NULL)) {
+        fprintf(stderr, "could not reach the game from the title menu\n");
+        return 1;
+    }
+
+    Bot bot;
+    bot_init(&bot, &config);
+    Canvas* canvas = host_canvas_get();
+    uint32_t end = furi_get_tick() + (uint32_t)(hours * 3600000.0);
+    while((int32_t)(end - furi_get_tick()) > 0 && !ctx->should_exit) {
+        uint32_t now = furi_get_tick();
+        uint32_t start = perf_clock();
+        session_step(ctx, &bot);
+        bot_record_tick(&bot, perf_elapsed_us(start));
+
+        start = perf_clock();
+        render_callback(canvas, ctx);
+        bot_record_draw(&bot, perf_elapsed_us(start));
+        if(game == GAME_STATE_FLIP_IQ && ctx->state == GAME_STATE_TITLE) soak_replay(ctx, game, now);
+        soak_check(ctx, game, now);
+    }
+    if(game == GAME_STATE_FLIP_IQ && soak_game_overs == 0) soak_report("no Flip IQ game ever ended", ctx, furi_get_tick());
+
+    BotReport* report = &bot.report;
+    printf("mode        %s\n", session_game_name(game));
+    printf("game time   %.2f h\n", hours);
+    printf("ticks       %lu\n", (unsigned long)report->ticks);
+    printf("inputs      %lu\n", (unsigned long)report->inputs);
+    printf("score       %d\n", report->score);
+    printf("max streak  %d\n", report->max_streak);
+    printf("tick us     avg %llu worst %lu\n",
+        (unsigned long long)(report->ticks ? report->total_tick_us / report->ticks : 0),
+        (unsigned long)report->worst_tick_us);
+    printf("draw us     avg %llu worst %lu\n",
+        (unsigned long long)(report->frames ? report->total_draw_us / report->frames : 0),
+        (unsigned long)report->worst_draw_us);
+    printf("canvas ops  %lu\n", (unsigned long)host_canvas_ops());
+    printf("arena peak  %u/%u bytes, %lu failed\n", game_arena_peak(ctx), MODE_ARENA_BYTES,
+        (unsigned long)(ctx->arena.failed + ctx->scratch.failed));
+    printf("last window us  min/avg/p99/max\n");
+    for(int i = 0; i < PERF_PHASE_COUNT; i++) {
+        const PerfReport* phase = &ctx->perf.phases[i].report;
+        uint32_t samples = 0;
+        for(int b = 0; b < PERF_BUCKETS; b++) samples += phase->histogram[b];
+        if(samples == 0) continue; // Phase never ran
+        printf("  %-6s %lu/%lu/%lu/%lu\n", perf_phase_names[i], (unsigned long)phase->min_us,
+            (unsigned long)phase->avg_us, (unsigned long)phase->p99_us, (unsigned long)phase->max_us);
+    }
+    if(game == GAME_STATE_FLIP_IQ) printf("game overs  %d\n", soak_game_overs);
+    printf("resume      %s\n", resume);
+    printf("violations  %d\n", soak_violations);
+    view_port_free(view_port);
+    return soak_violations ? 1 : 0;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+// Silent SAM so USE_SAM_TTS builds link on the host
+typedef struct {
+    int unused;
+} STM32SAM;
+
+void sam_init(STM32SAM* sam);
+void sam_say(STM32SAM* sam, const char* text);
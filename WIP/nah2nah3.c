@@ -7,190 +7,43 @@
 #include <furi_hal.h>
 #include <furi_hal_speaker.h>
 #include <furi_hal_vibro.h>
-#include "stm32_sam.h"
-
-// Constants for screen and game mechanics
-#define SCREEN_WIDTH 128
-#define SCREEN_HEIGHT 64
-#define PORTRAIT_WIDTH 64
-#define PORTRAIT_HEIGHT 128
-#define FPS_BASE 22
-#define MAX_STREAK_INT 9999 // Arbitrary max for streak to handle overflow
-#define COOLDOWN_MS 180000 // 3 minutes
-#define NOTIFICATION_MS 1500 // 1.5 seconds
-#define FIXED_POINT_SCALE 1000 // Scale for fixed-point arithmetic
-#define BACK_BUTTON_COOLDOWN 500 // 500ms cooldown for Back button
-#define ORIENTATION_HOLD_MS 1500 // 1.5s for orientation toggle
-#define CREDITS_FPS 11700 // 11.7 FPS = 85ms per frame
-#define LOADING_MS 1500 // 1.5s loading screen
-#define TAP_DRM_MS 300 // 0.3s for tap DRM
-#define MIN_SPEED_BPM 65 // Minimum speed for speed bar
-#define SPEED_BAR_Y (PORTRAIT_HEIGHT - 8)
-#define SPEED_BAR_HEIGHT 2
-#define SPEED_BAR_X 0
-#define SPEED_BAR_WIDTH PORTRAIT_WIDTH
-
-// Global limit for objects across games
-#define WORLD_OBJ_LIMIT 8 // Comment: Adjust for performance tuning
-
-// Game states for the mini-game suite
-typedef enum {
-    GAME_STATE_LOADING, // Initial loading screen
-    GAME_STATE_TITLE,
-    GAME_STATE_ROTATE,
-    GAME_STATE_ZERO_HERO,
-    GAME_STATE_FLIP_ZIP,
-    GAME_STATE_LINE_CAR, // Racing simulator
-    GAME_STATE_FLIP_IQ,  // IQ-based game (replaces Drop Per)
-    GAME_STATE_TECTONE_SIM, // Streamer simulator
-    GAME_STATE_SPACE_FLIGHT, // Space flight game
-    GAME_STATE_CREDITS,
-    GAME_STATE_PAUSE
-} GameState;
-
-// Game modes for menu selection
-typedef enum {
-    GAME_MODE_ZERO_HERO,
-    GAME_MODE_FLIP_ZIP,
-    GAME_MODE_LINE_CAR,
-    GAME_MODE_FLIP_IQ,     // Replaces Drop Per
-    GAME_MODE_TECTONE_SIM,
-    GAME_MODE_SPACE_FLIGHT
-} GameMode;
-
-// Difficulty levels
-typedef enum {
-    DIFFICULTY_EASY,
-    DIFFICULTY_MEDIUM,
-    DIFFICULTY_HARD
-} Difficulty;
-
-// Game context structure to hold all game states and variables
-typedef struct {
-    GameState state;
-    GameMode selected_game;
-    bool is_left_handed;
-    uint32_t last_input_time;
-    uint8_t rapid_click_count;
-    uint32_t game_start_time;
-    bool is_day;
-    uint32_t day_night_toggle_time;
-    // Title menu
-    int selected_side; // 0: left, 1: right
-    int selected_row; // 0: row1, 1: row2, 2: row3
-    int title_scroll_offset; // For scrolling menu
-    uint32_t back_hold_start; // Track back button hold time
-    // Rotate animation
-    uint32_t rotate_start_time;
-    int32_t rotate_angle; // Fixed-point (degrees * FIXED_POINT_SCALE)
-    int32_t zoom_factor; // Fixed-point (scale * FIXED_POINT_SCALE)
-    bool rotate_skip;
-    // Zero Hero
-    int streak;
-    int prev_streak;
-    int highest_streak;
-    int streak_sum;
-    int streak_count;
-    int oflow;
-    Difficulty difficulty;
-    uint32_t last_difficulty_check;
-    int key_columns[5][WORLD_OBJ_LIMIT]; // U, L, O, R, D - Adjusted to 2D array for Flip IQ balls
-    int key_positions[5][10]; // Up to 10 keys per column
-    bool is_holding[5];
-    bool strum_hit[5]; // Highlight strumming bar on hit
-    int score;
-    int score_oflow;
-    uint32_t last_notification_time;
-    char notification_text[32];
-    uint8_t note_q_a; // 0: none, 1: YES, 2: NO
-    int notification_x; // Scrolling position for notifications
-    // Flip Zip
-    int mascot_lane; // 0 to 4
-    int mascot_y; // Vertical position in lanes plane
-    int speed_bpm;
-    uint32_t last_back_press;
-    bool is_jumping;
-    int32_t jump_progress; // Fixed-point (progress * FIXED_POINT_SCALE)
-    int jump_scale; // Grow/shrink during jump
-    uint32_t jump_hold_time; // Track OK button hold duration
-    int successful_jumps; // Count for speed increases
-    int obstacles[5][10]; // Obstacle type per lane
-    int obstacle_positions[5][10];
-    uint32_t last_tap_time; // For tap DRM and speed boost
-    int tap_count; // Track taps for BPM calculation
-    uint32_t tap_window_start; // Start of tap window for BPM
-    int jump_y_accumulated; // Track Up presses during jump
-    // Line Car
-    int car_lane; // Current lane (0-4)
-    int car_y; // Vertical position
-    int car_angle; // Rotation angle (0, 8, 15 degrees) - Simplified to offset instead of rotation
-    int prev_car_lane; // Track previous lane for drift comparison
-    int track_pieces[5][WORLD_OBJ_LIMIT]; // Lengths of track pieces per lane
-    int track_positions[5][WORLD_OBJ_LIMIT]; // Positions of track pieces
-    int uber_points; // Skill points from drifting
-    int drift_multiplier; // Multiplier for successful drifts
-    uint32_t last_drift_time; // Timer for drift duration (693ms)
-    bool is_drifting; // Drift state
-    int fast_line; // 20 pixels below UI (26 + 20 = 46)
-    int slow_line; // 20 pixels above marquee (128 - 7 - 20 = 101)
-    // Flip IQ
-    int ball_width; // Width of initial drop ball
-    uint32_t round_start_time; // Timer for round duration
-    bool floor_check_flag; // Flag for floor removal
-    int active_lanes; // Number of active lanes (5 to 2)
-    int ball_count; // Total balls to drop per round
-    int balls_on_screen[WORLD_OBJ_LIMIT]; // Positions of balls
-    int ball_sizes[WORLD_OBJ_LIMIT]; // Sizes of balls
-    bool ball_broken[WORLD_OBJ_LIMIT]; // Broken state
-    // Tectone Sim
-    int anger; // Emotion levels (0-9)
-    int based; // Emotion levels (0-9)
-    int cuteness; // Emotion levels (0-9)
-    int sad; // Emotion levels (0-9)
-    uint32_t emotion_cooldown; // Cooldown for emotion actions
-    int tectone_x; // X position in bedroom
-    uint32_t move_cooldown; // Time between movements
-    uint32_t last_move_time; // Last movement time
-    int comment_heights[WORLD_OBJ_LIMIT]; // Heights of comments
-    int comment_positions[WORLD_OBJ_LIMIT]; // Y positions of comments
-    bool hype_train[WORLD_OBJ_LIMIT]; // Hype train state
-    uint32_t hype_cooldown; // Hype train cooldown
-    // Space Flight
-    int ship_health; // Player health (9-199)
-    int ship_armor; // Player armor (19-99)
-    int screen_type; // Current view type (forward, upward, etc.)
-    int objects[WORLD_OBJ_LIMIT][3]; // [x, y, size] for objects
-    uint32_t last_sequence_time; // Cooldown for special sequences
-    int recent_inputs[5]; // Track last 5 inputs
-    // Common
-    ViewPort* view_port;
-    bool should_exit;
-    uint32_t last_back_press_time;
-    uint32_t last_ai_update; // For faux-multithreading
-    uint8_t frame_counter; // For faux-multithreading
-    uint8_t start_back_count; // For title menu back count
-    uint8_t pause_back_count; // For pause menu back count
-    int credits_y; // For credits scrolling
-    uint8_t ai_beat_counter; // Added for AI-driven updates
-} GameContext;
-
-// SAM Text-to-Speech instance
+#include <storage/storage.h>
+#include "nah2nah3.h"
+#include "nah2nah3_timeline.h"
+#include "nah2nah3_plan.h"
+#include "nah2nah3_render.h"
+#include "nah2nah3_tts.h"
+#if NAH_BOT
+#include "nah2nah3_bot.h"
+#endif // NAH_BOT
+
+// SAM Text-to-Speech worker
 #if USE_SAM_TTS
-static STM32SAM voice;
+static Tts speech;
 #endif // USE_SAM_TTS
 
+// Autoplayer for soak runs, built with -DNAH_BOT=1
+#if NAH_BOT
+static Bot autoplay_bot;
+#endif // NAH_BOT
+
 // Static data for credits, notifications, and menu
 static const char* credits_lines[] = {
     "", "Nah2-Nah3", "    ", "    ", "Nah Nah Nah", "    ", "   ", "to the", "    ", "    ", "Nah", ""
 };
+#if NAH_ZERO_HERO
 static const char* notification_messages[] = {
     "Whoa!", "Is it hot or just you?", "Your fingers are lit", "GO GO GO", "You Got This!", "Positive Statement!",
     "Keep Rocking!", "You're on Fire!", "Smash It!", "Unstoppable!", "Epic Moves!"
 };
+#endif // NAH_ZERO_HERO
+#if NAH_LINE_CAR
 // New notification messages for Line Car
 static const char* line_car_notifications[] = {
     "+1 Uber Point Awarded!!!", "%d UP so far!", "OOF, Off Track", "Just lost %d UP!!!"
 };
+#endif // NAH_LINE_CAR
+#if NAH_FLIP_IQ
 // New notification messages for Flip IQ (5 positive, 5 negative)
 static const char* flip_iq_notifications_positive[] = {
     "Great Dodge!", "Nice Climb!", "IQ Rising!", "Sharp Move!", "Genius Play!"
@@ -198,147 +51,334 @@ static const char* flip_iq_notifications_positive[] = {
 static const char* flip_iq_notifications_negative[] = {
     "Ouch, Stumble!", "Missed That!", "IQ Drop!", "Careful Now!", "Fell Behind!"
 };
+#endif // NAH_FLIP_IQ
+#if NAH_TECTONE_SIM
 // Tectone Sim comment sections
 static const char* tectone_starters[] = {"You know tec ", "Whoa! ", "1", "&%#!@ "};
 static const char* tectone_subjects[] = {"BRO ", "look at her ", "he didn't ", "%#!@ "};
 static const char* tectone_climaxes[] = {"but it is ", "OMG ", "  ...  ", "is this real ", "that's it"};
 static const char* tectone_endpoints[] = {" D-O-N-E", "!!!!!!!", "$%!@$", "BOOM!", "YES"};
-static const char* tectone_emotion_phrases[][4] = {
-    {"I don't know boys, I didn't say it.", "That's a One Boys", "1 in chat", "Don't let the other side base you down brothers"},
-    {"Well, I am six-six chunky hunky", "Look right here", ";-)", "<3"},
-    {"Slams Desk", "Cursing", "Ranting", "Beep Sounds"},
-    {"Repeats Based", "Pumps Gun", "Eyebrows Up", "Points Up"}
+#endif // NAH_TECTONE_SIM
+
+// Title menu, two games per row; only games built in are listed
+static const struct {
+    GameMode mode;
+    const char* title;
+    const char* subtitle;
+} menu_entries[] = {
+#if NAH_ZERO_HERO
+    {GAME_MODE_ZERO_HERO, "Zero Hero", "Jamin Banin"},
+#endif // NAH_ZERO_HERO
+#if NAH_FLIP_ZIP
+    {GAME_MODE_FLIP_ZIP, "Flip Zip", "Runin & Jumpin"},
+#endif // NAH_FLIP_ZIP
+#if NAH_LINE_CAR
+    {GAME_MODE_LINE_CAR, "Line Car", "Drift or Nah"},
+#endif // NAH_LINE_CAR
+#if NAH_FLIP_IQ
+    {GAME_MODE_FLIP_IQ, "Flip IQ", "Flip Your IQ"},
+#endif // NAH_FLIP_IQ
+#if NAH_TECTONE_SIM
+    {GAME_MODE_TECTONE_SIM, "Tectone Sim", "Based Hits"},
+#endif // NAH_TECTONE_SIM
+#if NAH_SPACE_FLIGHT
+    {GAME_MODE_SPACE_FLIGHT, "Space Flight", "Star Chase"},
+#endif // NAH_SPACE_FLIGHT
 };
+#define MENU_COUNT ((int)COUNT_OF(menu_entries))
+#define MENU_ROWS ((MENU_COUNT + 1) / 2)
 
-static const char* menu_titles[][2] = {
-    {"Zero Hero", "Flip Zip"},
-    {"Line Car", "Flip IQ"},
-    {"Tectone Sim", "Space Flight"}
+// Animation tracks, evaluated once per tick in update_animations()
+static const TimelineKey title_sweep_keys[] = {
+    {0, FX_FROM_INT(0), TimelineEaseLinear},
+    {3000, FX_FROM_INT(30), TimelineEaseLinear},
+};
+static const TimelineKey title_ship_x_keys[] = {
+    {0, FX_FROM_INT(0), TimelineEaseLinear},
+    {2000, FX_FROM_INT(20), TimelineEaseLinear},
 };
-static const char* menu_subtitles[][2] = {
-    {"Jamin Banin", "Runin & Jumpin"},
-    {"Drift or Nah", "Flip Your IQ"},
-    {"Based Hits", "Star Chase"}
+static const TimelineKey title_ship_y_keys[] = {
+    {0, FX_FROM_INT(0), TimelineEaseInOut},
+    {750, FX_FROM_INT(9), TimelineEaseInOut},
+    {1500, FX_FROM_INT(0), TimelineEaseLinear},
+};
+static const TimelineKey blink_keys[] = {
+    {0, FX_FROM_INT(0), TimelineEaseStep},
+    {200, FX_FROM_INT(1), TimelineEaseStep},
+    {400, FX_FROM_INT(0), TimelineEaseStep},
+};
+static const TimelineKey paw_keys[] = {
+    {0, FX_FROM_INT(0), TimelineEaseStep},
+    {300, FX_FROM_INT(1), TimelineEaseStep},
+    {600, FX_FROM_INT(0), TimelineEaseStep},
+};
+static const TimelineKey rotate_zoom_keys[] = {
+    {0, FX_ONE, TimelineEaseInOut},
+    {ROTATE_ANIM_MS, FX_FROM_INT(3), TimelineEaseLinear},
+};
+// Raw binary angle rather than Q16.16, lerp does not care about units
+static const TimelineKey rotate_angle_keys[] = {
+    {0, 0, TimelineEaseInOut},
+    {ROTATE_ANIM_MS, FX_DEG(90), TimelineEaseLinear},
+};
+#define CREDITS_LINE_COUNT ((int)(sizeof(credits_lines) / sizeof(credits_lines[0])))
+#define CREDITS_START_Y (SCREEN_HEIGHT + 10 * (CREDITS_LINE_COUNT - 1))
+static const TimelineKey credits_keys[] = {
+    {0, FX_FROM_INT(CREDITS_START_Y), TimelineEaseLinear},
+    {(CREDITS_START_Y + 11) * CREDITS_STEP_MS, FX_FROM_INT(-11), TimelineEaseLinear},
 };
 
-// Word-wrap text without strtok, safe for Flipper Zero’s limited stdlib
-static void draw_word_wrapped_text(Canvas* canvas, const char* text, int x, int y, int max_width, Font font) {
-    if(!canvas || !text) return; // Prevent null pointer crashes
-    char buffer[32];
-    int buffer_idx = 0;
-    int current_x = x;
-    int current_y = y;
-    size_t text_len = strlen(text);
-    int char_width = (font == FontPrimary) ? 8 : 6;
-
-    canvas_set_font(canvas, font);
-    for(size_t i = 0; i <= text_len; i++) {
-        if(text[i] == ' ' || text[i] == '\0' || buffer_idx >= (int)(sizeof(buffer) - 1)) {
-            if(buffer_idx > 0) {
-                buffer[buffer_idx] = '\0';
-                int word_width = buffer_idx * char_width;
-                if(current_x + word_width > x + max_width) {
-                    current_x = x;
-                    current_y += (font == FontPrimary) ? 10 : 8;
-                }
-                canvas_draw_str(canvas, current_x, current_y, buffer);
-                current_x += word_width + char_width;
-                buffer_idx = 0;
+#define TRACK(keys, loop) {keys, sizeof(keys) / sizeof(keys[0]), loop}
+static const TimelineTrack title_sweep_track = TRACK(title_sweep_keys, true);
+static const TimelineTrack title_ship_x_track = TRACK(title_ship_x_keys, true);
+static const TimelineTrack title_ship_y_track = TRACK(title_ship_y_keys, true);
+static const TimelineTrack blink_track = TRACK(blink_keys, true);
+static const TimelineTrack paw_track = TRACK(paw_keys, true);
+static const TimelineTrack rotate_zoom_track = TRACK(rotate_zoom_keys, false);
+static const TimelineTrack rotate_angle_track = TRACK(rotate_angle_keys, false);
+static const TimelineTrack credits_track = TRACK(credits_keys, false);
+
+// Looping tracks baked to per-frame tables at startup
+static int16_t title_sweep_frames[30];
+static int16_t title_ship_x_frames[20];
+static int16_t title_ship_y_frames[10];
+static int16_t blink_frames[2];
+static int16_t paw_frames[2];
+static TimelineTable title_sweep_table = {&title_sweep_track, title_sweep_frames, 30, 100};
+static TimelineTable title_ship_x_table = {&title_ship_x_track, title_ship_x_frames, 20, 100};
+static TimelineTable title_ship_y_table = {&title_ship_y_track, title_ship_y_frames, 10, 150};
+static TimelineTable blink_table = {&blink_track, blink_frames, 2, 200};
+static TimelineTable paw_table = {&paw_track, paw_frames, 2, 300};
+
+static void animations_init(void) {
+    timeline_table_bake(&title_sweep_table);
+    timeline_table_bake(&title_ship_x_table);
+    timeline_table_bake(&title_ship_y_table);
+    timeline_table_bake(&blink_table);
+    timeline_table_bake(&paw_table);
+}
+
+// xorshift32 per context instead of rand(), so seeded runs repeat and host threads never share state
+static void game_seed(GameContext* ctx, uint32_t seed) {
+    ctx->rng = seed ? seed : 0x2545F491U;
+}
+
+static int game_rand(GameContext* ctx) {
+    uint32_t x = ctx->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    ctx->rng = x;
+    return (int)(x >> 1);
+}
+
+// Spawn limit under the adaptive cap, as a share of a compiled limit
+static int game_cap(const GameContext* ctx, int limit) {
+    int cap = limit * ctx->capacity / CAPACITY_FULL;
+    return cap > 0 ? cap : 1;
+}
+
+// String scratch for the draw code. Only the GUI thread draws, so one static
+// copy stands in for the char arrays each draw function kept on its stack.
+static struct {
+    char text[32]; // Formatted string about to be drawn
+    char line[32]; // Line draw_wrapped_parts is filling
+    char word[32]; // Word draw_wrapped_parts is gathering
+    char avg[12];
+    char p99[12];
+} draw_scratch;
+
+// Widths of the static strings drawn, GUI thread only like draw_scratch
+static TextCache text_cache;
+
+// Width of a word piece, cached when it has static storage
+static int draw_span_width(Canvas* canvas, TextCache* cache, Font font, const char* text, size_t length) {
+    return cache ? text_span_width(cache, canvas, font, text, length) : text_span_measure(canvas, font, text, length);
+}
+
+// Word-wrap the text of parts run together, without strtok, safe for Flipper
+// Zero’s limited stdlib. A word may run across parts. A line's width is the
+// sum of its words and spaces, as the fonts have no kerning. With a cache the
+// parts must have static storage and each word is measured once; without,
+// words are measured as drawn.
+static void draw_wrapped_parts(
+    Canvas* canvas, const char* const* parts, int count, int x, int y, int max_width, Font font, TextCache* cache) {
+    char* line = draw_scratch.line;
+    char* word = draw_scratch.word;
+    size_t line_len = 0;
+    int line_width = 0;
+    int line_height = (font == FontPrimary) ? 10 : 8;
+    int space = draw_span_width(canvas, cache, font, " ", 1);
+
+    int part = 0;
+    const char* text = count > 0 ? parts[0] : "";
+    while(true) {
+        while(part < count && (*text == ' ' || *text == '\0')) {
+            if(*text == ' ') {
+                text++;
+            } else if(++part < count) {
+                text = parts[part];
             }
-        } else {
-            buffer[buffer_idx++] = text[i];
         }
+        if(part >= count) break;
+        size_t word_len = 0;
+        int word_width = 0;
+        while(part < count && *text != ' ' && word_len < sizeof(draw_scratch.word) - 1) {
+            if(*text == '\0') {
+                if(++part < count) text = parts[part];
+                continue;
+            }
+            size_t len = strcspn(text, " ");
+            if(len > sizeof(draw_scratch.word) - 1 - word_len) len = sizeof(draw_scratch.word) - 1 - word_len; // Split overlong words
+            memcpy(&word[word_len], text, len);
+            word_width += draw_span_width(canvas, cache, font, text, len);
+            word_len += len;
+            text += len;
+        }
+        if(line_len > 0 && line_len + 1 + word_len < sizeof(draw_scratch.line) &&
+           line_width + space + word_width <= max_width) {
+            line[line_len] = ' ';
+            memcpy(&line[line_len + 1], word, word_len);
+            line_len += 1 + word_len;
+            line_width += space + word_width;
+            continue;
+        }
+        if(line_len > 0) {
+            line[line_len] = '\0';
+            canvas_draw_str(canvas, x, y, line);
+            y += line_height;
+        }
+        // First word of a line goes in even if it is too wide
+        memcpy(line, word, word_len);
+        line_len = word_len;
+        line_width = word_width;
+    }
+    if(line_len > 0) {
+        line[line_len] = '\0';
+        canvas_draw_str(canvas, x, y, line);
     }
     canvas_set_font(canvas, FontSecondary);
 }
 
+// Word-wrap formatted text, measured as drawn
+static void draw_word_wrapped_text(Canvas* canvas, const char* text, int x, int y, int max_width, Font font) {
+    if(!canvas || !text) return; // Prevent null pointer crashes
+    draw_wrapped_parts(canvas, &text, 1, x, y, max_width, font, NULL);
+}
+
+// Word-wrap a static string, its words measured once through text_cache
+static void draw_static_wrapped_text(Canvas* canvas, const char* text, int x, int y, int max_width, Font font) {
+    if(!canvas || !text) return;
+    draw_wrapped_parts(canvas, &text, 1, x, y, max_width, font, &text_cache);
+}
+
+// Left edge that centres a static string across span, flush left if it is wider
+static int draw_center_x(Canvas* canvas, const char* text, int span, Font font) {
+    int x = text_center(span, text_width(&text_cache, canvas, font, text));
+    return x < 0 ? 0 : x;
+}
+
+#if NAH_ZERO_HERO || NAH_FLIP_ZIP || NAH_LINE_CAR || NAH_TECTONE_SIM || NAH_SPACE_FLIGHT
 // Draw notifications with scrolling support
-static void draw_notification(Canvas* canvas, GameContext* ctx) {
-    if(!canvas || !ctx || ctx->notification_text[0] == '\0') return;
-    uint32_t elapsed = furi_get_tick() - ctx->last_notification_time;
-    if(elapsed > NOTIFICATION_MS && ctx->note_q_a == 0) {
-        ctx->notification_text[0] = '\0';
-        ctx->notification_x = 0;
-        return;
+static void draw_notification(Canvas* canvas, const RenderSnapshot* snap) {
+    if(!canvas || !snap || !snap->notification.text) return;
+    const char* text = snap->notification.text;
+    uint16_t width;
+    if(snap->notification.formatted) {
+        snprintf(draw_scratch.text, sizeof(draw_scratch.text), text, snap->notification.value);
+        text = draw_scratch.text;
+        width = text_measure(canvas, FontSecondary, text);
+    } else {
+        width = text_width(&text_cache, canvas, FontSecondary, text);
     }
     canvas_set_color(canvas, ColorBlack);
     canvas_draw_box(canvas, 0, PORTRAIT_HEIGHT - 7, PORTRAIT_WIDTH, 7);
     canvas_set_color(canvas, ColorWhite);
-    int text_width = strlen(ctx->notification_text) * 6;
-    int x = (ctx->note_q_a == 0) ? ctx->notification_x : (PORTRAIT_WIDTH - text_width) / 2;
-    draw_word_wrapped_text(canvas, ctx->notification_text, x, PORTRAIT_HEIGHT - 1, PORTRAIT_WIDTH, FontSecondary);
+    draw_word_wrapped_text(canvas, text, notify_x(width, snap->notification_elapsed), PORTRAIT_HEIGHT - 1, PORTRAIT_WIDTH, FontSecondary);
+}
+#endif // NAH_ZERO_HERO || NAH_FLIP_ZIP || NAH_LINE_CAR || NAH_TECTONE_SIM || NAH_SPACE_FLIGHT
+
+#if NAH_ZERO_HERO || NAH_FLIP_ZIP || NAH_LINE_CAR
+// Streak, score and day/night marker at the top of the lane games
+static void draw_hud(Canvas* canvas, const RenderSnapshot* snap) {
+    char* text = draw_scratch.text;
+    snprintf(text, sizeof(draw_scratch.text), "Streak: %d.%d", snap->hud.streak, snap->hud.oflow);
+    canvas_set_color(canvas, ColorWhite);
+    draw_word_wrapped_text(canvas, text, text_center(PORTRAIT_WIDTH, text_measure(canvas, FontSecondary, text)), 17, PORTRAIT_WIDTH, FontSecondary);
+    snprintf(text, sizeof(draw_scratch.text), "Score: %d.%d", snap->hud.score, snap->hud.score_oflow);
+    draw_word_wrapped_text(canvas, text, text_center(PORTRAIT_WIDTH, text_measure(canvas, FontSecondary, text)), 26, PORTRAIT_WIDTH, FontSecondary);
+    if(snap->is_day) {
+        canvas_draw_circle(canvas, 2, 10, 3);
+    } else {
+        canvas_set_color(canvas, ColorWhite);
+        canvas_draw_circle(canvas, 2, 10, 3);
+        canvas_set_color(canvas, ColorBlack);
+    }
+}
+#endif // NAH_ZERO_HERO || NAH_FLIP_ZIP || NAH_LINE_CAR
+
+// Animated preview of the selected game, x0 is the left edge of its half
+static void draw_menu_preview(Canvas* canvas, const RenderSnapshot* snap, GameMode mode, int x0, int y_offset) {
+    if(mode == GAME_MODE_ZERO_HERO) {
+        for(int i = 0; i < 5; i++) {
+            int x = x0 + 3 + i * 10;
+            int y = y_offset + 12 + snap->title.sweep;
+            canvas_draw_str(canvas, x, y, "v");
+        }
+    } else if(mode == GAME_MODE_FLIP_ZIP) {
+        int x = x0 + 3 + snap->title.sweep;
+        canvas_draw_str(canvas, x, y_offset + 30, "F");
+    } else if(mode == GAME_MODE_LINE_CAR) {
+        int x = x0 + 10 + snap->title.sweep;
+        canvas_draw_str(canvas, x, y_offset + 30, "'.-.\\");
+    } else if(mode == GAME_MODE_FLIP_IQ) {
+        for(int i = 0; i < 5; i++) {
+            int x = x0 + 3 + i * 8;
+            int y = y_offset + 12 + snap->title.ball_y[i];
+            canvas_draw_disc(canvas, x, y, 2); // Black disc for Flip IQ preview
+        }
+    } else if(mode == GAME_MODE_TECTONE_SIM) {
+        int frame = snap->title.frame;
+        canvas_draw_str(canvas, x0 + 16, y_offset + 28, frame == 0 ? "(o_|o)!" : " !(0 |o)");
+        canvas_draw_str(canvas, x0 + 9, y_offset + 35, frame == 0 ? "/| " : " .-.");
+        canvas_draw_str(canvas, x0 + 39, y_offset + 35, frame == 0 ? " ,-." : " |\\");
+    } else if(mode == GAME_MODE_SPACE_FLIGHT) {
+        int x = x0 + 12 + snap->title.ship_x;
+        int y = y_offset + 19 + snap->title.ship_y;
+        canvas_draw_str(canvas, x, y, "C>");
+        canvas_draw_circle(canvas, x + 10, y + 12, 5);
+    }
 }
 
 // Draw title menu with scrolling support (limited to one row at a time)
-static void draw_title_menu(Canvas* canvas, GameContext* ctx) {
-    if(!canvas || !ctx) return;
+static void draw_title_menu(Canvas* canvas, const RenderSnapshot* snap) {
+    if(!canvas || !snap) return;
     canvas_set_color(canvas, ColorBlack);
     canvas_draw_box(canvas, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
     canvas_set_color(canvas, ColorWhite);
     canvas_draw_line(canvas, SCREEN_WIDTH / 2, 0, SCREEN_WIDTH / 2, SCREEN_HEIGHT);
 
-    int row = ctx->selected_row; // Display only the selected row
+    int row = snap->title.row; // Display only the selected row
     int y_offset = 3; // Fixed offset to center the single row
 
-    // Left option
-    if(ctx->selected_side == 0) {
-        canvas_set_color(canvas, ColorWhite);
-        canvas_draw_frame(canvas, 1, y_offset + 11, SCREEN_WIDTH / 2 - 2, 30);
-        canvas_draw_frame(canvas, 0, y_offset + 10, SCREEN_WIDTH / 2, 32);
-        canvas_set_color(canvas, ColorBlack);
-        canvas_draw_box(canvas, 2, y_offset + 12, SCREEN_WIDTH / 2 - 4, 28);
-        canvas_set_color(canvas, ColorWhite);
-    } else {
-        canvas_draw_frame(canvas, 1, y_offset + 11, SCREEN_WIDTH / 2 - 2, 30);
-    }
-    canvas_draw_str(canvas, 10, y_offset + 8, menu_titles[row][0]);
-    draw_word_wrapped_text(canvas, menu_subtitles[row][0], 10, y_offset + 50, SCREEN_WIDTH / 2 - 20, FontSecondary);
-    if(ctx->selected_side == 0) {
-        if(row == 0) { // Zero Hero
-            for(int i = 0; i < 5; i++) {
-                int x = 3 + i * 10;
-                int y = y_offset + 12 + (furi_get_tick() / 100) % 30;
-                canvas_draw_str(canvas, x, y, "v");
-            }
-        } else if(row == 1) { // Line Car
-            int x = 10 + (furi_get_tick() / 100) % 30;
-            canvas_draw_str(canvas, x, y_offset + 30, "'.-.\\");
-        } else { // Tectone Sim
-            int frame = (furi_get_tick() / 200) % 2;
-            canvas_draw_str(canvas, 16, y_offset + 28, frame == 0 ? "(o_|o)!" : " !(0 |o)");
-            canvas_draw_str(canvas, 9, y_offset + 35, frame == 0 ? "/| " : " .-.");
-            canvas_draw_str(canvas, 39, y_offset + 35, frame == 0 ? " ,-." : " |\\");
+    // Left option, then the right one if this row has it
+    for(int side = 0; side < 2 && row * 2 + side < MENU_COUNT; side++) {
+        int x0 = side * (SCREEN_WIDTH / 2);
+        if(snap->title.side == side) {
+            canvas_set_color(canvas, ColorWhite);
+            canvas_draw_frame(canvas, x0 + 1, y_offset + 11, SCREEN_WIDTH / 2 - 2, 30);
+            canvas_draw_frame(canvas, x0, y_offset + 10, SCREEN_WIDTH / 2, 32);
+            canvas_set_color(canvas, ColorBlack);
+            canvas_draw_box(canvas, x0 + 2, y_offset + 12, SCREEN_WIDTH / 2 - 4, 28);
+            canvas_set_color(canvas, ColorWhite);
+        } else {
+            canvas_draw_frame(canvas, x0 + 1, y_offset + 11, SCREEN_WIDTH / 2 - 2, 30);
         }
-    }
-
-    // Right option
-    if(ctx->selected_side == 1) {
-        canvas_set_color(canvas, ColorWhite);
-        canvas_draw_frame(canvas, SCREEN_WIDTH / 2 + 1, y_offset + 11, SCREEN_WIDTH / 2 - 2, 30);
-        canvas_draw_frame(canvas, SCREEN_WIDTH / 2, y_offset + 10, SCREEN_WIDTH / 2, 32);
-        canvas_set_color(canvas, ColorBlack);
-        canvas_draw_box(canvas, SCREEN_WIDTH / 2 + 2, y_offset + 12, SCREEN_WIDTH / 2 - 4, 28);
-        canvas_set_color(canvas, ColorWhite);
-    } else {
-        canvas_draw_frame(canvas, SCREEN_WIDTH / 2 + 1, y_offset + 11, SCREEN_WIDTH / 2 - 2, 30);
-    }
-    canvas_draw_str(canvas, SCREEN_WIDTH / 2 + 10, y_offset + 8, menu_titles[row][1]);
-    draw_word_wrapped_text(canvas, menu_subtitles[row][1], SCREEN_WIDTH / 2 + 10, y_offset + 50, SCREEN_WIDTH / 2 - 20, FontSecondary);
-    if(ctx->selected_side == 1) {
-        if(row == 0) { // Flip Zip
-            int x = SCREEN_WIDTH / 2 + 3 + (furi_get_tick() / 100) % 30;
-            canvas_draw_str(canvas, x, y_offset + 30, "F");
-        } else if(row == 1) { // Flip IQ
-            for(int i = 0; i < 5; i++) {
-                int x = SCREEN_WIDTH / 2 + 3 + i * 8;
-                int y = y_offset + 12 + (furi_get_tick() / 100 + i * 5) % 30;
-                canvas_draw_disc(canvas, x, y, 2); // Black disc for Flip IQ preview
-            }
-        } else { // Space Flight
-            int x = SCREEN_WIDTH / 2 + 12 + (furi_get_tick() / 100) % 20;
-            int y = y_offset + 19 + (furi_get_tick() / 150) % 10;
-            canvas_draw_str(canvas, x, y, "C>");
-            canvas_draw_circle(canvas, x + 10, y + 12, 5);
+        canvas_draw_str(canvas, x0 + 10, y_offset + 8, menu_entries[row * 2 + side].title);
+        draw_static_wrapped_text(
+            canvas, menu_entries[row * 2 + side].subtitle, x0 + 10, y_offset + 50, SCREEN_WIDTH / 2 - 20, FontSecondary);
+        if(snap->title.side == side) {
+            draw_menu_preview(canvas, snap, menu_entries[row * 2 + side].mode, x0, y_offset);
         }
     }
 }
@@ -349,7 +389,7 @@ static void draw_loading_screen(Canvas* canvas) {
     canvas_set_color(canvas, ColorBlack);
     canvas_draw_box(canvas, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
     canvas_set_color(canvas, ColorWhite);
-    draw_word_wrapped_text(canvas, "Nah to the Nah Nah Nah", 10, SCREEN_HEIGHT / 2, SCREEN_WIDTH - 20, FontPrimary);
+    draw_static_wrapped_text(canvas, "Nah to the Nah Nah Nah", 10, SCREEN_HEIGHT / 2, SCREEN_WIDTH - 20, FontPrimary);
 }
 
 // Draw pause screen
@@ -362,17 +402,17 @@ static void draw_pause_screen(Canvas* canvas) {
     canvas_set_color(canvas, ColorBlack);
     canvas_draw_box(canvas, PORTRAIT_WIDTH / 2 - 18, PORTRAIT_HEIGHT / 2 - 8, 36, 16);
     canvas_set_color(canvas, ColorWhite);
-    canvas_draw_str(canvas, PORTRAIT_WIDTH / 2 - 12, PORTRAIT_HEIGHT / 2 + 4, "Pause");
+    canvas_draw_str(canvas, draw_center_x(canvas, "Pause", PORTRAIT_WIDTH, FontSecondary), PORTRAIT_HEIGHT / 2 + 4, "Pause");
+    canvas_draw_str(canvas, draw_center_x(canvas, "Up: suspend", PORTRAIT_WIDTH, FontSecondary), PORTRAIT_HEIGHT / 2 + 24, "Up: suspend");
 }
 
 // Draw rotate screen with Flipper animation
-static void draw_rotate_screen(Canvas* canvas, GameContext* ctx) {
-    if(!canvas || !ctx) return;
+static void draw_rotate_screen(Canvas* canvas, const RenderSnapshot* snap) {
+    if(!canvas || !snap) return;
     canvas_set_color(canvas, ColorWhite);
     canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PORTRAIT_HEIGHT);
     canvas_set_color(canvas, ColorBlack);
-    uint32_t elapsed = furi_get_tick() - ctx->rotate_start_time;
-    if(elapsed < 1000) {
+    if(snap->rotate.phase == 0) {
         canvas_draw_frame(canvas, 20, 10, 88, 44);
         canvas_draw_str(canvas, 54, 54, "FLIPPER");
         canvas_draw_circle(canvas, 54, 50, 10);
@@ -380,35 +420,34 @@ static void draw_rotate_screen(Canvas* canvas, GameContext* ctx) {
         canvas_draw_disc(canvas, 90, 50, 5); // Filled smaller circle
         canvas_set_color(canvas, ColorWhite);
         canvas_draw_str(canvas, 64, 32, ">");
-    } else if(elapsed < 6000 && !ctx->rotate_skip) {
-        int32_t t = ((elapsed - 1000) * FIXED_POINT_SCALE) / 5000;
-        ctx->rotate_angle = (t * 90) / FIXED_POINT_SCALE;
-        ctx->zoom_factor = FIXED_POINT_SCALE + (t * 2);
-        int w = (88 * ctx->zoom_factor) / FIXED_POINT_SCALE;
-        int h = (44 * ctx->zoom_factor) / FIXED_POINT_SCALE;
+    } else if(snap->rotate.phase == 1) {
+        int w = fx_scale(88, snap->rotate.zoom_factor);
+        int h = fx_scale(44, snap->rotate.zoom_factor);
+        int r_large = fx_scale(10, snap->rotate.zoom_factor);
+        int r_small = fx_scale(5, snap->rotate.zoom_factor);
         int x = (SCREEN_WIDTH - w) / 2;
         int y = (SCREEN_HEIGHT - h) / 2;
         canvas_draw_frame(canvas, x, y, w, h);
         canvas_draw_str(canvas, x + w / 2, y + h + 4, "FLIPPER");
-        canvas_draw_circle(canvas, x + w / 2, y + h + (10 * ctx->zoom_factor) / FIXED_POINT_SCALE, (10 * ctx->zoom_factor) / FIXED_POINT_SCALE);
+        canvas_draw_circle(canvas, x + w / 2, y + h + r_large, r_large);
         canvas_set_color(canvas, ColorBlack);
-        canvas_draw_disc(canvas, x + w - (5 * ctx->zoom_factor) / FIXED_POINT_SCALE, y + h + (5 * ctx->zoom_factor) / FIXED_POINT_SCALE, (5 * ctx->zoom_factor) / FIXED_POINT_SCALE);
+        canvas_draw_disc(canvas, x + w - r_small, y + h + r_small, r_small);
         canvas_set_color(canvas, ColorBlack);
         int arrow_x = x + w / 2;
         int arrow_y = y + h / 2;
-        canvas_draw_str(canvas, arrow_x, arrow_y, (t < FIXED_POINT_SCALE / 2) ? ">" : "^");
+        canvas_draw_str(canvas, arrow_x, arrow_y, (snap->rotate.angle < FX_DEG(45)) ? ">" : "^");
     } else {
-        view_port_set_orientation(ctx->view_port, ctx->is_left_handed ? ViewPortOrientationVerticalFlip : ViewPortOrientationVertical);
         canvas_set_color(canvas, ColorWhite);
         canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PORTRAIT_HEIGHT);
         canvas_set_color(canvas, ColorBlack);
-        draw_word_wrapped_text(canvas, " PLEASE  ROTATE  YOUR  SCREEN     >>>>> ", 5, 20, PORTRAIT_WIDTH - 10, FontPrimary);
+        draw_static_wrapped_text(canvas, " PLEASE  ROTATE  YOUR  SCREEN     >>>>> ", 5, 20, PORTRAIT_WIDTH - 10, FontPrimary);
     }
 }
 
+#if NAH_ZERO_HERO
 // Draw Zero Hero game with arrow symbols
-static void draw_zero_hero(Canvas* canvas, GameContext* ctx) {
-    if(!canvas || !ctx) return;
+static void draw_zero_hero(Canvas* canvas, const RenderSnapshot* snap) {
+    if(!canvas || !snap) return;
     canvas_set_font(canvas, FontSecondary);
     canvas_set_color(canvas, ColorWhite);
     canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PORTRAIT_HEIGHT);
@@ -420,45 +459,29 @@ static void draw_zero_hero(Canvas* canvas, GameContext* ctx) {
         canvas_draw_str(canvas, i * 12 + 4, PORTRAIT_HEIGHT - 5, i == 0 ? "^" : i == 1 ? "<" : i == 2 ? "O" : i == 3 ? ">" : "v");
     }
     for(int i = 0; i < 5; i++) {
-        canvas_set_color(canvas, ctx->strum_hit[i] ? ColorWhite : ColorBlack);
+        canvas_set_color(canvas, snap->zero_hero.strum_hit[i] ? ColorWhite : ColorBlack);
         canvas_draw_box(canvas, i * 12 + 2, PORTRAIT_HEIGHT - 6, 10, 2);
-        if(ctx->strum_hit[i]) {
+        if(snap->zero_hero.strum_hit[i]) {
             canvas_set_color(canvas, ColorBlack);
             canvas_draw_frame(canvas, i * 12 + 1, PORTRAIT_HEIGHT - 7, 12, 4);
             canvas_set_color(canvas, ColorWhite);
         }
     }
     canvas_draw_box(canvas, 0, PORTRAIT_HEIGHT - 4, PORTRAIT_WIDTH, 4);
-    for(int i = 0; i < 5; i++) {
-        for(int j = 0; j < 10; j++) {
-            if(ctx->key_positions[i][j] > 0) {
-                canvas_draw_str(canvas, i * 12 + 4, ctx->key_positions[i][j], i == 0 ? "^" : i == 1 ? "<" : i == 2 ? "O" : i == 3 ? ">" : "v");
-            }
-        }
-    }
-    char streak_str[32];
-    snprintf(streak_str, sizeof(streak_str), "Streak: %d.%d", ctx->streak, ctx->oflow);
-    canvas_set_color(canvas, ColorBlack);
-    canvas_set_color(canvas, ColorWhite);
-    draw_word_wrapped_text(canvas, streak_str, (PORTRAIT_WIDTH - strlen(streak_str) * 6) / 2, 17, PORTRAIT_WIDTH, FontSecondary);
-    char score_str[32];
-    snprintf(score_str, sizeof(score_str), "Score: %d.%d", ctx->score, ctx->score_oflow);
-    canvas_set_color(canvas, ColorBlack);
-    canvas_set_color(canvas, ColorWhite);
-    draw_word_wrapped_text(canvas, score_str, (PORTRAIT_WIDTH - strlen(score_str) * 6) / 2, 26, PORTRAIT_WIDTH, FontSecondary);
-    if(ctx->is_day) {
-        canvas_draw_circle(canvas, 2, 10, 3);
-    } else {
-        canvas_set_color(canvas, ColorWhite);
-        canvas_draw_circle(canvas, 2, 10, 3);
-        canvas_set_color(canvas, ColorBlack);
+    const EntityList* notes = &snap->entities;
+    for(int i = 0; i < notes->count; i++) {
+        int lane = notes->lane[i];
+        canvas_draw_str(canvas, lane * 12 + 4, notes->y[i], lane == 0 ? "^" : lane == 1 ? "<" : lane == 2 ? "O" : lane == 3 ? ">" : "v");
     }
-    draw_notification(canvas, ctx);
+    draw_hud(canvas, snap);
+    draw_notification(canvas, snap);
 }
+#endif // NAH_ZERO_HERO
 
+#if NAH_FLIP_ZIP
 // Draw Flip Zip game with speed bar
-static void draw_flip_zip(Canvas* canvas, GameContext* ctx) {
-    if(!canvas || !ctx) return;
+static void draw_flip_zip(Canvas* canvas, const RenderSnapshot* snap) {
+    if(!canvas || !snap) return;
     canvas_set_color(canvas, ColorWhite);
     canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PORTRAIT_HEIGHT);
     canvas_set_color(canvas, ColorBlack);
@@ -473,272 +496,247 @@ static void draw_flip_zip(Canvas* canvas, GameContext* ctx) {
     canvas_draw_line(canvas, 0, PORTRAIT_HEIGHT - 2, PORTRAIT_WIDTH * 2 / 5, PORTRAIT_HEIGHT - 2);
     canvas_draw_line(canvas, 0, PORTRAIT_HEIGHT - 1, PORTRAIT_WIDTH * 1 / 5, PORTRAIT_HEIGHT - 1);
     canvas_set_color(canvas, ColorBlack);
-    const char* mascot_char = ctx->jump_scale > 0 ? "F" : "f"; 
-    int mascot_y = PORTRAIT_HEIGHT - 7 - ctx->mascot_y - (ctx->is_jumping ? (ctx->jump_progress * 10 / FIXED_POINT_SCALE) : 0);
-    canvas_draw_str(canvas, ctx->mascot_lane * 12 + 4, mascot_y, mascot_char);
-    for(int i = 0; i < 5; i++) {
-        for(int j = 0; j < 10; j++) {
-            if(ctx->obstacle_positions[i][j] > 0) {
-                char symbol = ctx->obstacles[i][j] == 1 ? 'O' : ctx->obstacles[i][j] == 2 ? '-' : 'S';
-                canvas_draw_str(canvas, i * 12 + 4, ctx->obstacle_positions[i][j], &symbol);
-            }
-        }
-    }
-    char streak_str[32];
-    snprintf(streak_str, sizeof(streak_str), "Streak: %d.%d", ctx->streak, ctx->oflow);
-    canvas_set_color(canvas, ColorBlack);
-    canvas_set_color(canvas, ColorWhite);
-    draw_word_wrapped_text(canvas, streak_str, (PORTRAIT_WIDTH - strlen(streak_str) * 6) / 2, 17, PORTRAIT_WIDTH, FontSecondary);
-    char score_str[32];
-    snprintf(score_str, sizeof(score_str), "Score: %d.%d", ctx->score, ctx->score_oflow);
-    canvas_set_color(canvas, ColorBlack);
-    canvas_set_color(canvas, ColorWhite);
-    draw_word_wrapped_text(canvas, score_str, (PORTRAIT_WIDTH - strlen(score_str) * 6) / 2, 26, PORTRAIT_WIDTH, FontSecondary);
-    if(ctx->is_day) {
-        canvas_draw_circle(canvas, 2, 10, 3);
-    } else {
-        canvas_set_color(canvas, ColorWhite);
-        canvas_draw_circle(canvas, 2, 10, 3);
-        canvas_set_color(canvas, ColorBlack);
+    canvas_draw_str(canvas, snap->flip_zip.lane * 12 + 4, snap->flip_zip.mascot_y, snap->flip_zip.airborne ? "F" : "f");
+    const EntityList* obstacles = &snap->entities;
+    for(int i = 0; i < obstacles->count; i++) {
+        uint8_t type = obstacles->type[i];
+        canvas_draw_str(canvas, obstacles->lane[i] * 12 + 4, obstacles->y[i], type == 1 ? "O" : type == 2 ? "-" : "S");
     }
+    draw_hud(canvas, snap);
     // Draw speed bar
     canvas_set_color(canvas, ColorBlack);
     canvas_draw_box(canvas, SPEED_BAR_X, SPEED_BAR_Y, SPEED_BAR_WIDTH, SPEED_BAR_HEIGHT);
     int reward_bpm_x = SPEED_BAR_X + (SPEED_BAR_WIDTH * 2 / 3); // 2/3 mark for reward BPM
     canvas_draw_line(canvas, reward_bpm_x, SPEED_BAR_Y - 2, reward_bpm_x, SPEED_BAR_Y + SPEED_BAR_HEIGHT + 1); // Reward BPM marker
-    int speed_bpm = ctx->speed_bpm < MIN_SPEED_BPM ? MIN_SPEED_BPM : ctx->speed_bpm;
-    int speed_bar_pos = SPEED_BAR_X + ((speed_bpm - MIN_SPEED_BPM) * SPEED_BAR_WIDTH) / (ctx->speed_bpm - MIN_SPEED_BPM + 1); // Scale BPM to bar width
-    canvas_draw_line(canvas, speed_bar_pos, SPEED_BAR_Y, speed_bar_pos, SPEED_BAR_Y + SPEED_BAR_HEIGHT - 1);
-    draw_notification(canvas, ctx);
+    canvas_draw_line(canvas, snap->flip_zip.speed_bar_x, SPEED_BAR_Y, snap->flip_zip.speed_bar_x, SPEED_BAR_Y + SPEED_BAR_HEIGHT - 1);
+    draw_notification(canvas, snap);
 }
+#endif // NAH_FLIP_ZIP
 
+#if NAH_LINE_CAR
 // Draw Line Car game with scrolling tracks
-static void draw_line_car(Canvas* canvas, GameContext* ctx) {
-    if(!canvas || !ctx) return;
+static void draw_line_car(Canvas* canvas, const RenderSnapshot* snap) {
+    if(!canvas || !snap) return;
     canvas_set_color(canvas, ColorWhite);
     canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PORTRAIT_HEIGHT);
     canvas_set_color(canvas, ColorBlack);
     canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, 26); // UI box for score and streak
     canvas_set_color(canvas, ColorWhite);
-    for(int i = 0; i < 5; i++) {
-        for(int j = 0; j < WORLD_OBJ_LIMIT; j++) {
-            if(ctx->track_positions[i][j] > 0 && ctx->track_positions[i][j] < PORTRAIT_HEIGHT) {
-                canvas_draw_box(canvas, i * 12, ctx->track_positions[i][j] - ctx->track_pieces[i][j], 12, ctx->track_pieces[i][j]);
-            }
+    const EntityList* tracks = &snap->entities;
+    for(int i = 0; i < tracks->count; i++) {
+        int position = tracks->y[i];
+        if(position > 0 && position - tracks->size[i] < PORTRAIT_HEIGHT) {
+            canvas_draw_box(canvas, tracks->lane[i] * 12, position - tracks->size[i], 12, tracks->size[i]);
         }
     }
     // Draw car: 3x1 base, 3-pixel line, 3x1 top with border
-    int car_y = ctx->car_y;
-    canvas_draw_box(canvas, ctx->car_lane * 12 + 4, car_y, 3, 1); // Base
-    canvas_draw_line(canvas, ctx->car_lane * 12 + 5, car_y - 3, ctx->car_lane * 12 + 5, car_y); // Shaft
-    canvas_draw_box(canvas, ctx->car_lane * 12 + 4, car_y - 4, 3, 1); // Top
-    canvas_draw_frame(canvas, ctx->car_lane * 12 + 3, car_y - 5, 5, 6); // 1-pixel border with thick corners
-    if(ctx->car_angle != 0) {
-        int offset_x = (ctx->car_angle > 0) ? 2 : -2; // Offset for drift visualization
-        canvas_draw_box(canvas, ctx->car_lane * 12 + 4 + offset_x, car_y, 3, 1);
+    int car_x = snap->line_car.lane * 12;
+    int car_y = snap->line_car.car_y;
+    canvas_draw_box(canvas, car_x + 4, car_y, 3, 1); // Base
+    canvas_draw_line(canvas, car_x + 5, car_y - 3, car_x + 5, car_y); // Shaft
+    canvas_draw_box(canvas, car_x + 4, car_y - 4, 3, 1); // Top
+    canvas_draw_frame(canvas, car_x + 3, car_y - 5, 5, 6); // 1-pixel border with thick corners
+    if(snap->line_car.car_angle != 0) {
+        int offset_x = (snap->line_car.car_angle > 0) ? 2 : -2; // Offset for drift visualization
+        canvas_draw_box(canvas, car_x + 4 + offset_x, car_y, 3, 1);
     }
     // Wiggle during drift (medium/hard difficulty)
-    if(ctx->is_drifting && ctx->difficulty > DIFFICULTY_EASY && abs(ctx->car_lane - ctx->prev_car_lane) > 2) {
-        int dx = (rand() % 7) - 3; // -3 to +3 pixels
-        canvas_draw_box(canvas, ctx->car_lane * 12 + 4 + dx, car_y, 3, 1);
-        furi_delay_ms(3);
-        canvas_draw_box(canvas, ctx->car_lane * 12 + 4, car_y, 3, 1);
-    }
-    char streak_str[32];
-    snprintf(streak_str, sizeof(streak_str), "Streak: %d.%d", ctx->streak, ctx->oflow); // Drift multiplier
-    canvas_set_color(canvas, ColorBlack);
-    canvas_set_color(canvas, ColorWhite);
-    draw_word_wrapped_text(canvas, streak_str, (PORTRAIT_WIDTH - strlen(streak_str) * 6) / 2, 17, PORTRAIT_WIDTH, FontSecondary);
-    char score_str[32];
-    snprintf(score_str, sizeof(score_str), "Score: %d.%d", ctx->score, ctx->score_oflow);
-    canvas_set_color(canvas, ColorBlack);
-    canvas_set_color(canvas, ColorWhite);
-    draw_word_wrapped_text(canvas, score_str, (PORTRAIT_WIDTH - strlen(score_str) * 6) / 2, 26, PORTRAIT_WIDTH, FontSecondary);
-    if(ctx->is_day) {
-        canvas_draw_circle(canvas, 2, 10, 3);
-    } else {
-        canvas_set_color(canvas, ColorWhite);
-        canvas_draw_circle(canvas, 2, 10, 3);
-        canvas_set_color(canvas, ColorBlack);
+    if(snap->line_car.wiggle) {
+        canvas_draw_box(canvas, car_x + 4 + snap->line_car.wiggle_dx, car_y, 3, 1);
+        canvas_draw_box(canvas, car_x + 4, car_y, 3, 1);
     }
-    draw_notification(canvas, ctx);
+    draw_hud(canvas, snap); // Streak shows the drift multiplier
+    draw_notification(canvas, snap);
 }
+#endif // NAH_LINE_CAR
 
-// Draw Line Car title screen
-static void draw_line_car_title(Canvas* canvas, GameContext* ctx) {
-    if(!canvas || !ctx) return;
+#if NAH_LINE_CAR || NAH_FLIP_IQ || NAH_SPACE_FLIGHT
+// Title card before Line Car, Flip IQ and Space Flight
+static void draw_game_title(Canvas* canvas, const RenderSnapshot* snap, const char* title) {
+    if(!canvas || !snap) return;
     canvas_set_color(canvas, ColorWhite);
     canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PORTRAIT_HEIGHT);
     canvas_set_color(canvas, ColorBlack);
-    uint32_t elapsed = furi_get_tick() - ctx->game_start_time;
-    if(elapsed < 1300) {
+    if(snap->intro_ms < GAME_TITLE_MS) {
         return; // Wait 1.3s for text to appear
     }
-    draw_word_wrapped_text(canvas, "Line Car", PORTRAIT_WIDTH / 2 - 24, PORTRAIT_HEIGHT / 2 - 10, 48, FontPrimary);
-    // Add bold border with white pixels
-    for(int x = PORTRAIT_WIDTH / 2 - 28; x <= PORTRAIT_WIDTH / 2 + 20; x++) {
-        for(int y = PORTRAIT_HEIGHT / 2 - 14; y <= PORTRAIT_HEIGHT / 2 + 2; y++) {
-            canvas_draw_dot(canvas, x, y);
+    draw_static_wrapped_text(canvas, title, draw_center_x(canvas, title, PORTRAIT_WIDTH, FontPrimary), PORTRAIT_HEIGHT / 2 - 10, PORTRAIT_WIDTH, FontPrimary);
+    if(snap->state == GAME_STATE_LINE_CAR) {
+        // Add bold border with white pixels
+        for(int x = PORTRAIT_WIDTH / 2 - 28; x <= PORTRAIT_WIDTH / 2 + 20; x++) {
+            for(int y = PORTRAIT_HEIGHT / 2 - 14; y <= PORTRAIT_HEIGHT / 2 + 2; y++) {
+                canvas_draw_dot(canvas, x, y);
+            }
         }
     }
-    draw_word_wrapped_text(canvas, "OK->PLAY", PORTRAIT_WIDTH / 2 - 20, PORTRAIT_HEIGHT - 10, 40, FontSecondary);
-}
-
-// Draw Flip IQ title screen
-static void draw_flip_iq_title(Canvas* canvas, GameContext* ctx) {
-    if(!canvas || !ctx) return;
-    canvas_set_color(canvas, ColorWhite);
-    canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PORTRAIT_HEIGHT);
-    canvas_set_color(canvas, ColorBlack);
-    uint32_t elapsed = furi_get_tick() - ctx->game_start_time;
-    if(elapsed < 1300) {
-        return; // Wait 1.3s for text to appear
-    }
-    draw_word_wrapped_text(canvas, "Flip IQ", PORTRAIT_WIDTH / 2 - 20, PORTRAIT_HEIGHT / 2 - 10, 40, FontPrimary);
-    draw_word_wrapped_text(canvas, "OK->PLAY", PORTRAIT_WIDTH / 2 - 20, PORTRAIT_HEIGHT - 10, 40, FontSecondary);
-}
-
-// Draw Space Flight title screen
-static void draw_space_flight_title(Canvas* canvas, GameContext* ctx) {
-    if(!canvas || !ctx) return;
-    canvas_set_color(canvas, ColorWhite);
-    canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PORTRAIT_HEIGHT);
-    canvas_set_color(canvas, ColorBlack);
-    uint32_t elapsed = furi_get_tick() - ctx->game_start_time;
-    if(elapsed < 1300) {
-        return; // Wait 1.3s for text to appear
-    }
-    draw_word_wrapped_text(canvas, "Space Flight", PORTRAIT_WIDTH / 2 - 24, PORTRAIT_HEIGHT / 2 - 10, 48, FontPrimary);
-    draw_word_wrapped_text(canvas, "OK->PLAY", PORTRAIT_WIDTH / 2 - 20, PORTRAIT_HEIGHT - 10, 40, FontSecondary);
+    draw_static_wrapped_text(canvas, "OK->PLAY", draw_center_x(canvas, "OK->PLAY", PORTRAIT_WIDTH, FontSecondary), PORTRAIT_HEIGHT - 10, PORTRAIT_WIDTH, FontSecondary);
 }
+#endif // NAH_LINE_CAR || NAH_FLIP_IQ || NAH_SPACE_FLIGHT
 
+#if NAH_ZERO_HERO
 // Update Zero Hero game (AI-driven strumming)
 static void update_zero_hero(GameContext* ctx) {
     if(!ctx) return;
-    int fps = FPS_BASE + ctx->difficulty * 5;
+    int fps = ctx->tuning.fps_base + ctx->difficulty * 5;
     if(furi_get_tick() - ctx->last_ai_update < (uint32_t)(1000 / fps)) return;
     ctx->last_ai_update = furi_get_tick();
-    for(int i = 0; i < 5; i++) {
-        ctx->strum_hit[i] = false;
-        for(int j = 0; j < 10; j++) {
-            if(ctx->key_positions[i][j] > 0) {
-                ctx->key_positions[i][j] += 1;
-                if(ctx->key_positions[i][j] >= PORTRAIT_HEIGHT - 6 && ctx->key_positions[i][j] <= PORTRAIT_HEIGHT - 4) {
-                    if(ctx->is_holding[i]) {
-                        ctx->streak++;
-                        ctx->score++;
-                        ctx->key_positions[i][j] = 0;
-                        ctx->strum_hit[i] = true;
-                        if(ctx->streak >= MAX_STREAK_INT) {
-                            ctx->streak = 0;
-                            ctx->oflow++;
-                        }
-                        if(ctx->streak == 5) {
-                            strcpy(ctx->notification_text, "! Perfect !");
-                            ctx->last_notification_time = furi_get_tick();
-                            ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
-                        } else if(ctx->streak == 6) {
-                            strcpy(ctx->notification_text, "! STREAK STARTED !");
-                            ctx->last_notification_time = furi_get_tick();
-                            ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
-                        }
-                        ctx->streak_sum += ctx->streak;
-                        ctx->streak_count++;
-                        if(ctx->streak > ctx->highest_streak) ctx->highest_streak = ctx->streak;
-                    }
-                } else if(ctx->key_positions[i][j] > PORTRAIT_HEIGHT - 5) {
-                    ctx->key_positions[i][j] = 0;
+    EntityPool* pool = &ctx->pool;
+    for(int i = 0; i < 5; i++) ctx->strum_hit[i] = false;
+    for(int i = pool->count - 1; i >= 0; i--) {
+        uint8_t id = pool->active[i];
+        int lane = pool->lane[id];
+        pool->y[id] += 1;
+        if(pool->y[id] >= PORTRAIT_HEIGHT - 6 && pool->y[id] <= PORTRAIT_HEIGHT - 4) {
+            if(ctx->is_holding[lane]) {
+                ctx->streak++;
+                ctx->score++;
+                pool_kill(pool, id);
+                ctx->strum_hit[lane] = true;
+                if(ctx->streak >= MAX_STREAK_INT) {
                     ctx->streak = 0;
-                    strcpy(ctx->notification_text, "! Miss !");
-                    ctx->last_notification_time = furi_get_tick();
-                    ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
+                    ctx->oflow++;
                 }
+                if(ctx->streak == 5) {
+                    notify_push(&ctx->notify, "! Perfect !", NOTIFY_HIGH, furi_get_tick());
+                } else if(ctx->streak == 6) {
+                    notify_push(&ctx->notify, "! STREAK STARTED !", NOTIFY_HIGH, furi_get_tick());
+                }
+                ctx->streak_sum += ctx->streak;
+                ctx->streak_count++;
+                if(ctx->streak > ctx->highest_streak) ctx->highest_streak = ctx->streak;
             }
+        } else if(pool->y[id] > PORTRAIT_HEIGHT - 5) {
+            pool_kill(pool, id);
+            ctx->streak = 0;
+            notify_push(&ctx->notify, "! Miss !", NOTIFY_NORMAL, furi_get_tick());
         }
     }
-    if(ctx->ai_beat_counter++ % 10 == 0) {
-        int lane = rand() % 5;
-        for(int j = 0; j < 10; j++) {
-            if(ctx->key_positions[lane][j] == 0) {
-                ctx->key_positions[lane][j] = 7;
-                break;
-            }
+    if(ctx->ai_beat_counter++ % ctx->tuning.note_spawn_ticks == 0) {
+        int lane = game_rand(ctx) % 5;
+        if(pool->lane_count[lane] < game_cap(ctx, LANE_OBJ_LIMIT)) {
+            uint8_t id = pool_spawn(pool, lane);
+            if(id != POOL_NONE) pool->y[id] = 7;
         }
     }
-    if(furi_get_tick() - ctx->last_difficulty_check > COOLDOWN_MS && ctx->streak > 5) {
+    if(furi_get_tick() - ctx->last_difficulty_check > ctx->tuning.difficulty_cooldown_ms && ctx->streak > ctx->tuning.difficulty_min_streak) {
         int avg_streak = ctx->streak_count > 0 ? ctx->streak_sum / ctx->streak_count : 0;
-        if(ctx->streak >= avg_streak * 3) {
+        if(ctx->streak >= avg_streak * ctx->tuning.difficulty_streak_factor) {
             if(ctx->difficulty < DIFFICULTY_HARD) ctx->difficulty++;
             ctx->last_difficulty_check = furi_get_tick();
-            int msg_idx = rand() % (sizeof(notification_messages) / sizeof(notification_messages[0]));
-            strcpy(ctx->notification_text, notification_messages[msg_idx]);
-            ctx->last_notification_time = furi_get_tick();
-            ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
+            int msg_idx = game_rand(ctx) % (sizeof(notification_messages) / sizeof(notification_messages[0]));
+            notify_push(&ctx->notify, notification_messages[msg_idx], NOTIFY_LOW, furi_get_tick());
         }
     }
 }
+#endif // NAH_ZERO_HERO
+
+#if NAH_FLIP_ZIP
+// Next obstacle row: walk the rows on screen from the mascot up to the spawn
+// line, then pick up to walls lanes that still leave a way through. Rows are
+// told apart by y, since a row spawns at once and scrolls as one.
+static uint8_t flip_zip_plan_row(const GameContext* ctx, int speed_modifier, int walls, uint32_t random) {
+    const EntityPool* pool = &ctx->pool;
+    int update_ms = 3000 / ctx->tuning.fps_base; // Updates run every third timer tick
+    PlanLimits limits = {
+        .lane_ticks = (FLIP_ZIP_LANE_MS + update_ms - 1) / update_ms,
+        .jump_ticks = JUMP_TICKS,
+    };
+    PlanReach reach;
+    int cooldown = ctx->is_jumping ? (FX_ONE - ctx->jump_progress + JUMP_STEP - 1) / JUMP_STEP : 0;
+    plan_start(&reach, 1 << ctx->mascot_lane, cooldown);
+    int last = PORTRAIT_HEIGHT - 7 - ctx->mascot_y; // Mascot row, then each row passed
+    int below = last + 1;
+    for(;;) {
+        int y = -1;
+        uint8_t row = 0;
+        for(int i = 0; i < pool->count; i++) {
+            uint8_t id = pool->active[i];
+            int pos = pool->y[id];
+            if(pos >= below || pos < y) continue;
+            if(pos > y) {
+                y = pos;
+                row = 0;
+            }
+            row |= 1 << pool->lane[id];
+        }
+        if(y < 0) break;
+        plan_step(&reach, &limits, (last - y) / speed_modifier, row);
+        if(!plan_alive(&reach)) plan_start(&reach, PLAN_ALL_LANES, 0); // Already boxed in, plan for any lane
+        last = y;
+        below = y;
+    }
+    uint8_t allowed = 0;
+    for(int lane = 0; lane < 5; lane++) {
+        if(pool->lane_count[lane] < game_cap(ctx, LANE_OBJ_LIMIT)) allowed |= 1 << lane;
+    }
+    return plan_row(&reach, &limits, (last - 7) / speed_modifier, walls, allowed, random);
+}
 
 // Update Flip Zip game (AI-driven speed, improved jump, tap DRM, and speed boost)
 static void update_flip_zip(GameContext* ctx) {
     if(!ctx) return;
-    int fps = FPS_BASE + (ctx->speed_bpm > 0 ? ctx->speed_bpm / 10 : 0);
+    int fps = ctx->tuning.fps_base + (ctx->speed_bpm > 0 ? ctx->speed_bpm / 10 : 0);
     if(furi_get_tick() - ctx->last_ai_update < (uint32_t)(1000 / fps)) return;
     ctx->last_ai_update = furi_get_tick();
-    int speed_modifier = 1 + ctx->speed_bpm / 60;
-    for(int i = 0; i < 5; i++) {
-        for(int j = 0; j < 10; j++) {
-            if(ctx->obstacle_positions[i][j] > 0) {
-                ctx->obstacle_positions[i][j] += speed_modifier;
-                if(ctx->obstacle_positions[i][j] > PORTRAIT_HEIGHT - 7) {
-                    ctx->obstacle_positions[i][j] = 0;
-                    ctx->obstacles[i][j] = 0;
-                    ctx->score++;
-                    if(i == ctx->mascot_lane - 1 || i == ctx->mascot_lane + 1) {
-                        ctx->successful_jumps++;
-                        if(ctx->successful_jumps % 5 == 0) {
-                            ctx->speed_bpm += 10;
-                            if(ctx->speed_bpm > 120) ctx->speed_bpm = 120;
-                        }
-                    }
+    int speed_modifier = 1 + fx_to_int(fx_ratio(ctx->speed_bpm, FX_RECIP32(FLIP_ZIP_BASE_BPM)));
+    EntityPool* pool = &ctx->pool;
+    for(int i = pool->count - 1; i >= 0; i--) {
+        uint8_t id = pool->active[i];
+        pool->y[id] += speed_modifier;
+        if(pool->y[id] > PORTRAIT_HEIGHT - 7) {
+            int lane = pool->lane[id];
+            pool_kill(pool, id);
+            ctx->score++;
+            if(lane == ctx->mascot_lane - 1 || lane == ctx->mascot_lane + 1) {
+                ctx->successful_jumps++;
+                if(ctx->successful_jumps % ctx->tuning.speed_step_jumps == 0) {
+                    ctx->speed_bpm += ctx->tuning.speed_step_bpm;
+                    if(ctx->speed_bpm > ctx->tuning.speed_max_bpm) ctx->speed_bpm = ctx->tuning.speed_max_bpm;
                 }
             }
         }
     }
-    if(ctx->ai_beat_counter++ % 15 == 0) {
-        int lane = rand() % 5;
-        int type = rand() % 3 + 1;
-        for(int j = 0; j < 10; j++) {
-            if(ctx->obstacle_positions[lane][j] == 0) {
-                ctx->obstacle_positions[lane][j] = 7;
-                ctx->obstacles[lane][j] = type;
-                break;
-            }
+    if(ctx->ai_beat_counter++ % ctx->tuning.obstacle_spawn_ticks == 0) {
+        int walls = 1 + (ctx->speed_bpm > 0 ? ctx->speed_bpm / FLIP_ZIP_WALL_BPM : 0);
+        if(walls > PLAN_LANES - 1) walls = PLAN_LANES - 1;
+        uint8_t row = flip_zip_plan_row(ctx, speed_modifier, walls, game_rand(ctx));
+        for(int lane = 0; lane < 5; lane++) {
+            if(!(row & (1 << lane))) continue;
+            uint8_t id = pool_spawn(pool, lane);
+            if(id == POOL_NONE) break;
+            pool->y[id] = 7;
+            pool->type[id] = game_rand(ctx) % 3 + 1;
         }
     }
     if(ctx->is_jumping) {
-        ctx->jump_progress += 100;
-        if(ctx->jump_progress < FIXED_POINT_SCALE / 2) {
-            ctx->jump_scale = ctx->jump_progress / (FIXED_POINT_SCALE / 4);
-        } else if(ctx->jump_progress < FIXED_POINT_SCALE) {
-            ctx->jump_scale = (FIXED_POINT_SCALE - ctx->jump_progress) / (FIXED_POINT_SCALE / 4);
+        ctx->jump_progress += JUMP_STEP;
+        if(ctx->jump_progress < FX_HALF) {
+            ctx->jump_scale = ctx->jump_progress >> (FX_SHIFT - 2); // progress / 0.25
+        } else if(ctx->jump_progress < FX_ONE) {
+            ctx->jump_scale = (FX_ONE - ctx->jump_progress) >> (FX_SHIFT - 2);
         } else {
             if(ctx->jump_hold_time > 0 && furi_get_tick() - ctx->jump_hold_time < (uint32_t)(ctx->speed_bpm * 250)) {
-                ctx->jump_progress = FIXED_POINT_SCALE / 2;
+                ctx->jump_progress = FX_HALF;
                 ctx->jump_scale = 1;
             } else {
                 ctx->is_jumping = false;
                 ctx->jump_progress = 0;
                 ctx->jump_scale = 0;
+                ctx->jump_height = 0;
                 ctx->successful_jumps++;
                 ctx->mascot_y += ctx->jump_y_accumulated; // Apply accumulated Up presses
                 if(ctx->mascot_y > 20) ctx->mascot_y = 20; // Cap max height
                 ctx->jump_y_accumulated = 0; // Reset after landing
-                if(ctx->successful_jumps % 5 == 0) {
-                    ctx->speed_bpm += 10;
-                    if(ctx->speed_bpm > 120) ctx->speed_bpm = 120;
+                if(ctx->successful_jumps % ctx->tuning.speed_step_jumps == 0) {
+                    ctx->speed_bpm += ctx->tuning.speed_step_bpm;
+                    if(ctx->speed_bpm > ctx->tuning.speed_max_bpm) ctx->speed_bpm = ctx->tuning.speed_max_bpm;
                 }
             }
         }
+        // Progress 0..1 maps to half a turn, so the arc peaks mid-jump and while held
+        if(ctx->is_jumping) {
+            ctx->jump_height = fx_scale(JUMP_HEIGHT_PX, fx_sin((fx_angle_t)(ctx->jump_progress >> 1)));
+        }
         // Move forward 1 pixel per 10ms while airborne
         if(ctx->jump_scale > 0) {
             uint32_t airborne_time = furi_get_tick() - ctx->jump_hold_time;
@@ -747,59 +745,95 @@ static void update_flip_zip(GameContext* ctx) {
         }
     }
 }
+#endif // NAH_FLIP_ZIP
+
+#if NAH_LINE_CAR
+// Car over the segment of track under it
+static bool line_car_on_track(const GameContext* ctx) {
+    const TrackSegment* segment = track_at(&ctx->track, ctx->car_y);
+    return segment && segment->lane == ctx->car_lane;
+}
+
+// Extend the track above the top of the screen, each segment one lane over
+// from the last or straight on in the last lane. Longer segments while capped.
+static void line_car_extend(GameContext* ctx) {
+    Track* track = &ctx->track;
+    int min_length = 9 * WORLD_OBJ_LIMIT / game_cap(ctx, WORLD_OBJ_LIMIT);
+    while(track->top > 0) {
+        int length = min_length + game_rand(ctx) % 37; // 9-45 pixels at full cap
+        int lane = ctx->car_lane;
+        if(track->count) {
+            int last = track_get(track, track->count - 1)->lane;
+            lane = last + (game_rand(ctx) % 2 ? 1 : -1);
+            if(lane < 0) lane = 1; // Avoid edge wrap to left
+            if(lane > 4) lane = 3; // Avoid edge wrap to right
+            if(last == 4 && game_rand(ctx) % 2) lane = 4; // Allow straight tracks in last lane
+        }
+        if(!track_push(track, lane, length)) break;
+    }
+}
+
+// Wiggle during a drift across more than two lanes (medium/hard difficulty)
+static bool line_car_wiggles(const GameContext* ctx) {
+    return ctx->is_drifting && ctx->difficulty > DIFFICULTY_EASY && abs(ctx->car_lane - ctx->prev_car_lane) > 2;
+}
+
+// Move the car a lane for the tap the input thread recorded, drifting while
+// Down is held, and score the move on the track as it is now
+static void line_car_steer(GameContext* ctx) {
+    int step = atomic_exchange(&ctx->lane_request, 0);
+    int lane = ctx->car_lane + step;
+    if(step == 0 || lane < 0 || lane > 4) return;
+    ctx->prev_car_lane = ctx->car_lane;
+    ctx->car_lane = lane;
+    if(ctx->is_holding[4]) { // Drifting with Down
+        ctx->is_drifting = true;
+        ctx->car_angle = step * 8; // Drift angle
+        ctx->last_drift_time = furi_get_tick();
+        ctx->drift_multiplier++;
+    } else {
+        ctx->car_angle = step * 15; // Rotation angle
+        if(line_car_on_track(ctx)) {
+            ctx->uber_points++;
+            notify_push(&ctx->notify, line_car_notifications[0], NOTIFY_NORMAL, furi_get_tick());
+        }
+    }
+}
 
 // Update Line Car game (track scrolling, player movement, scoring)
 static void update_line_car(GameContext* ctx) {
     if(!ctx) return;
-    int fps = FPS_BASE + (ctx->speed_bpm > 0 ? ctx->speed_bpm / 10 : 0);
+    line_car_steer(ctx);
+    int fps = ctx->tuning.fps_base + (ctx->speed_bpm > 0 ? ctx->speed_bpm / 10 : 0);
     if(furi_get_tick() - ctx->last_ai_update < (uint32_t)(1000 / fps)) return;
     ctx->last_ai_update = furi_get_tick();
-    int speed_modifier = ctx->speed_bpm / 78; // Base speed at 78 BPM
+    fx_t speed = fx_ratio(ctx->speed_bpm, FX_RECIP32(BASE_BPM)); // 1.0 at base BPM
+    int speed_modifier = fx_to_int(speed);
     // Adjust speed based on player position
     if(ctx->car_y < ctx->fast_line) {
         if(furi_get_tick() - ctx->last_ai_update > 150) {
-            ctx->speed_bpm += (ctx->speed_bpm * 0.01 < 700) ? 1 : 0; // Max 700% increase
+            ctx->speed_bpm += (speed < SPEED_SCALE_MAX) ? 1 : 0; // Max 700% increase
             ctx->last_ai_update = furi_get_tick();
         }
     } else if(ctx->car_y > ctx->slow_line) {
         if(furi_get_tick() - ctx->last_ai_update > 199) {
-            ctx->speed_bpm -= (ctx->speed_bpm * 0.01 > 66) ? 1 : 0; // Min 66% decrease
+            ctx->speed_bpm -= (speed > SPEED_SCALE_MIN) ? 1 : 0; // Min 66% decrease
             ctx->last_ai_update = furi_get_tick();
         }
     }
-    // Scroll tracks downward
-    for(int i = 0; i < 5; i++) {
-        for(int j = 0; j < WORLD_OBJ_LIMIT; j++) {
-            if(ctx->track_positions[i][j] > 0) {
-                ctx->track_positions[i][j] += speed_modifier;
-                if(ctx->track_positions[i][j] > PORTRAIT_HEIGHT) {
-                    ctx->track_positions[i][j] = 0;
-                    int length = (rand() % 37) + 9; // 9-45 pixels
-                    ctx->track_pieces[i][j] = length;
-                    ctx->track_positions[i][j] = -length; // Reset off-screen
-                    // Randomly decide next lane direction
-                    int next_lane = i + (rand() % 2 ? 1 : -1);
-                    if(next_lane < 0) next_lane = 1; // Avoid edge wrap to left
-                    if(next_lane > 4) next_lane = 3; // Avoid edge wrap to right
-                    if(i == 4 && rand() % 2) next_lane = 4; // Allow straight tracks in last lane
-                    ctx->track_positions[next_lane][j] = ctx->track_positions[i][j] - length;
-                    ctx->track_pieces[next_lane][j] = length;
-                }
-            }
-        }
-    }
+    // Scroll the track down, retire what left the bottom and extend it above the top
+    track_scroll(&ctx->track, speed_modifier, PORTRAIT_HEIGHT);
+    line_car_extend(ctx);
     // Check drift and scoring
-    if(ctx->is_drifting && furi_get_tick() - ctx->last_drift_time > 693) {
+    if(ctx->is_drifting && furi_get_tick() - ctx->last_drift_time > ctx->tuning.drift_ms) {
         ctx->is_drifting = false;
         ctx->car_angle = 0;
-        if(ctx->track_positions[ctx->car_lane][0] > 0 && ctx->car_y >= ctx->track_positions[ctx->car_lane][0] - ctx->track_pieces[ctx->car_lane][0]) {
+        if(line_car_on_track(ctx)) {
             ctx->score += ctx->uber_points * ctx->drift_multiplier;
-            snprintf(ctx->notification_text, sizeof(ctx->notification_text), line_car_notifications[0], ctx->uber_points * ctx->drift_multiplier);
+            notify_push(&ctx->notify, line_car_notifications[0], NOTIFY_NORMAL, furi_get_tick());
         } else {
-            snprintf(ctx->notification_text, sizeof(ctx->notification_text), line_car_notifications[3], ctx->uber_points * ctx->drift_multiplier);
+            notify_push_value(&ctx->notify, line_car_notifications[3], ctx->uber_points * ctx->drift_multiplier, NOTIFY_NORMAL, furi_get_tick());
         }
-        ctx->last_notification_time = furi_get_tick();
-        ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
         ctx->uber_points = 0;
         ctx->drift_multiplier = 1; // Reset multiplier
     }
@@ -808,459 +842,794 @@ static void update_line_car(GameContext* ctx) {
         ctx->car_y += speed_modifier;
         if(ctx->car_y > PORTRAIT_HEIGHT - 7) {
             ctx->car_y = PORTRAIT_HEIGHT - 7;
-            for(int i = 0; i < 5; i++) {
-                if(ctx->track_positions[i][0] > 0 && ctx->car_y >= ctx->track_positions[i][0] - ctx->track_pieces[i][0]) {
-                    ctx->car_lane = i;
-                    break;
-                }
-            }
-            // Check for off-track
-            if(ctx->track_positions[ctx->car_lane][0] == 0) {
-                strcpy(ctx->notification_text, line_car_notifications[2]);
-                ctx->last_notification_time = furi_get_tick();
-                ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
-                // Reposition to nearest track
-                for(int i = 0; i < 5; i++) {
-                    for(int j = 0; j < WORLD_OBJ_LIMIT; j++) {
-                        if(ctx->track_positions[i][j] > 0) {
-                            ctx->car_y = ctx->track_positions[i][j] - ctx->track_pieces[i][j] + (rand() % 10);
-                            ctx->car_lane = i;
-                            break;
-                        }
-                    }
-                    if(ctx->car_y < PORTRAIT_HEIGHT - 7) break;
+            const TrackSegment* segment = track_at(&ctx->track, ctx->car_y);
+            if(segment) {
+                ctx->car_lane = segment->lane;
+            } else {
+                // Off-track, reposition onto the lowest segment
+                notify_push(&ctx->notify, line_car_notifications[2], NOTIFY_HIGH, furi_get_tick());
+                if(ctx->track.count) {
+                    segment = track_get(&ctx->track, 0);
+                    ctx->car_y = segment->y - segment->length + (game_rand(ctx) % segment->length);
+                    ctx->car_lane = segment->lane;
                 }
             }
         }
     }
+    track_follow(&ctx->track, ctx->car_y);
     // Handle drift slowdown
     if(ctx->is_drifting && (ctx->car_y < ctx->fast_line || ctx->car_y > ctx->slow_line)) {
-        ctx->speed_bpm -= (ctx->speed_bpm * 0.01 > 66) ? 1 : 0; // Slow during drift
+        ctx->speed_bpm -= (speed > SPEED_SCALE_MIN) ? 1 : 0; // Slow during drift
     }
+    // Roll the wiggle here so publishing never draws from the game PRNG
+    ctx->wiggle_dx = line_car_wiggles(ctx) ? (game_rand(ctx) % 7) - 3 : 0; // -3 to +3 pixels
 }
+#endif // NAH_LINE_CAR
 
 // <!-- SPLIT POINT FOR PART 2 -->
 
-#if USE_SAM_TTS
-// SAM Text-to-Speech function
-static void SAMT2S(const char* text) {
-    if(furi_hal_speaker_is_mine() || furi_hal_speaker_acquire(1000)) {
-        char upper_text[32];
-        strncpy(upper_text, text, sizeof(upper_text) - 1);
-        upper_text[sizeof(upper_text) - 1] = '\0';
-        for(size_t i = 0; upper_text[i] != '\0'; i++) {
-            if(upper_text[i] >= 'a' && upper_text[i] <= 'z') {
-                upper_text[i] = upper_text[i] - 'a' + 'A';
-            }
+// Once per tick report: step the cap down when tick and draw p99 eat too much
+// of the timer period, back up when there is room. The draw report comes from
+// the GUI thread; a torn read only delays a step.
+static void game_capacity_update(GameContext* ctx) {
+    const PerfStats* tick = &ctx->perf.phases[PERF_PHASE_TICK];
+    if(tick->windows == ctx->capacity_window) return;
+    ctx->capacity_window = tick->windows;
+    uint32_t cost_us = tick->report.p99_us + ctx->perf.phases[PERF_PHASE_RENDER].report.p99_us;
+    uint32_t period_us = 1000000 / ctx->tuning.fps_base;
+    if(cost_us * 100 > period_us * CAPACITY_HIGH_PCT) {
+        if(ctx->capacity > CAPACITY_MIN) ctx->capacity--;
+    } else if(cost_us * 100 < period_us * CAPACITY_LOW_PCT) {
+        if(ctx->capacity < CAPACITY_FULL) ctx->capacity++;
+    }
+}
+
+// High-water mark of the running game's arena across all of its runs
+static uint16_t game_arena_peak(const GameContext* ctx) {
+    if(ctx->arena_mode >= GAME_MODE_COUNT) return 0;
+    uint16_t peak = ctx->arena_peak[ctx->arena_mode];
+    return ctx->arena.high_water > peak ? ctx->arena.high_water : peak;
+}
+
+// Hand the arena to a game that is starting: keep the last game's peak, drop
+// its data and carve the per-tick scratch again
+static void game_arena_enter(GameContext* ctx, GameMode mode) {
+    if(ctx->arena_mode < GAME_MODE_COUNT) ctx->arena_peak[ctx->arena_mode] = game_arena_peak(ctx);
+    arena_init(&ctx->arena, ctx->arena_buffer, sizeof(ctx->arena_buffer));
+    arena_sub(&ctx->arena, &ctx->scratch, SCRATCH_ARENA_BYTES);
+    ctx->arena_mode = mode;
+    ctx->comments = NULL;
+}
+
+// One stats record per GameMode
+_Static_assert(GAME_MODE_COUNT == STATS_MODES, "StatsFile needs a record per game");
+_Static_assert(POOL_SIZE >= 5 * LANE_OBJ_LIMIT, "EntityPool needs room for every lane full");
+_Static_assert(POOL_SIZE >= TRACK_RING, "Line Car publishes its track through the entity list");
+_Static_assert(InputKeyUp == 0 && InputKeyOk == COMBO_KEYS - 1, "Combos take InputKey values as keys");
+
+// A new session: counters start over on top of the game's lifetime record
+static void game_stats_begin(GameContext* ctx, GameMode mode) {
+    ctx->stats_base = ctx->stats.file.records[mode];
+    ctx->score = 0;
+    ctx->score_oflow = 0;
+    ctx->oflow = 0;
+    ctx->highest_streak = 0;
+    ctx->streak_sum = 0;
+    ctx->streak_count = 0;
+}
+
+// Fold the running session into the RAM record; the app loop writes it out
+static void game_stats_fold(GameContext* ctx) {
+    StatsRecord folded = ctx->stats_base;
+    int best_streak = ctx->streak > ctx->highest_streak ? ctx->streak : ctx->highest_streak;
+    folded.plays++;
+    if(ctx->score > folded.best_score) folded.best_score = ctx->score;
+    if(best_streak > folded.best_streak) folded.best_streak = best_streak;
+    folded.streak_sum += ctx->streak_sum;
+    folded.streak_count += ctx->streak_count;
+    folded.score_total += ctx->score;
+    StatsRecord* record = &ctx->stats.file.records[ctx->selected_game];
+    if(memcmp(record, &folded, sizeof(StatsRecord)) != 0) {
+        *record = folded;
+        atomic_store(&ctx->stats.dirty, true);
+    }
+}
+
+// Fold whenever a game stops running: pause, game over or back to the title
+static void game_stats_watch(GameContext* ctx) {
+    bool playing = ctx->state >= GAME_STATE_ZERO_HERO && ctx->state <= GAME_STATE_SPACE_FLIGHT;
+    if(ctx->stats_playing && !playing) game_stats_fold(ctx);
+    ctx->stats_playing = playing;
+}
+
+// Whether the game is in this build, see NAH_ZERO_HERO and friends
+static bool game_built_in(GameMode mode) {
+    for(int i = 0; i < MENU_COUNT; i++) {
+        if(menu_entries[i].mode == mode) return true;
+    }
+    return false;
+}
+
+#define SUSPEND_PATH APP_DATA_PATH("suspend.bin")
+#define SUSPEND_TEMP_PATH APP_DATA_PATH("suspend.tmp")
+#define SUSPEND_MODE(mode) (1U << (mode))
+#define SUSPEND_ALL 0xFF
+#define SUSPEND_ZERO_HERO SUSPEND_MODE(GAME_MODE_ZERO_HERO)
+#define SUSPEND_FLIP_ZIP SUSPEND_MODE(GAME_MODE_FLIP_ZIP)
+#define SUSPEND_LINE_CAR SUSPEND_MODE(GAME_MODE_LINE_CAR)
+#define SUSPEND_FLIP_IQ SUSPEND_MODE(GAME_MODE_FLIP_IQ)
+#define SUSPEND_TECTONE_SIM SUSPEND_MODE(GAME_MODE_TECTONE_SIM)
+#define SUSPEND_SPACE_FLIGHT SUSPEND_MODE(GAME_MODE_SPACE_FLIGHT)
+#define SUSPEND_COMMENT_BYTES (WORLD_OBJ_LIMIT * sizeof(TectoneComment)) // Tectone Sim chat, after the fields
+
+// GameContext field kept in the suspend snapshot
+typedef struct {
+    uint16_t offset;
+    uint16_t size;
+    uint8_t modes; // SUSPEND_MODE bits of the games that use it
+    bool time; // Tick, saved as its age so it lines up with the clock of the next launch
+} SuspendField;
+
+#define SUSPEND_FIELD(field, modes) {offsetof(GameContext, field), sizeof(((GameContext*)0)->field), modes, false}
+#define SUSPEND_TIME(field, modes) {offsetof(GameContext, field), sizeof(uint32_t), modes, true}
+
+// Held keys, notifications and effects are left out, they start over on resume
+static const SuspendField suspend_fields[] = {
+    // Score line, beat clock and PRNG of every game
+    SUSPEND_FIELD(is_left_handed, SUSPEND_ALL),
+    SUSPEND_FIELD(streak, SUSPEND_ALL),
+    SUSPEND_FIELD(prev_streak, SUSPEND_ALL),
+    SUSPEND_FIELD(highest_streak, SUSPEND_ALL),
+    SUSPEND_FIELD(streak_sum, SUSPEND_ALL),
+    SUSPEND_FIELD(streak_count, SUSPEND_ALL),
+    SUSPEND_FIELD(oflow, SUSPEND_ALL),
+    SUSPEND_FIELD(score, SUSPEND_ALL),
+    SUSPEND_FIELD(score_oflow, SUSPEND_ALL),
+    SUSPEND_FIELD(difficulty, SUSPEND_ALL),
+    SUSPEND_FIELD(speed_bpm, SUSPEND_ALL),
+    SUSPEND_FIELD(is_day, SUSPEND_ALL),
+    SUSPEND_FIELD(ai_beat_counter, SUSPEND_ALL),
+    SUSPEND_FIELD(frame_counter, SUSPEND_ALL),
+    SUSPEND_FIELD(rng, SUSPEND_ALL),
+    SUSPEND_FIELD(stats_base, SUSPEND_ALL),
+    SUSPEND_TIME(game_start_time, SUSPEND_ALL),
+    SUSPEND_TIME(day_night_toggle_time, SUSPEND_ALL),
+    SUSPEND_TIME(last_ai_update, SUSPEND_ALL),
+    SUSPEND_TIME(last_difficulty_check, SUSPEND_ALL),
+    // Entities, only the fields each game uses; slots and the free stack are rebuilt on resume
+    SUSPEND_FIELD(pool.x, SUSPEND_SPACE_FLIGHT),
+    SUSPEND_FIELD(pool.y, SUSPEND_ALL),
+    SUSPEND_FIELD(pool.size, SUSPEND_FLIP_IQ | SUSPEND_TECTONE_SIM | SUSPEND_SPACE_FLIGHT),
+    SUSPEND_FIELD(pool.z, SUSPEND_SPACE_FLIGHT),
+    SUSPEND_FIELD(pool.vy, SUSPEND_FLIP_IQ),
+    SUSPEND_FIELD(pool.sub_y, SUSPEND_FLIP_IQ),
+    SUSPEND_FIELD(pool.type, SUSPEND_FLIP_ZIP | SUSPEND_FLIP_IQ | SUSPEND_SPACE_FLIGHT),
+    SUSPEND_FIELD(pool.lane, SUSPEND_ALL),
+    SUSPEND_FIELD(pool.active, SUSPEND_ALL),
+    SUSPEND_FIELD(pool.count, SUSPEND_ALL),
+    // Flip Zip
+    SUSPEND_FIELD(mascot_lane, SUSPEND_FLIP_ZIP),
+    SUSPEND_FIELD(mascot_y, SUSPEND_FLIP_ZIP),
+    SUSPEND_FIELD(is_jumping, SUSPEND_FLIP_ZIP),
+    SUSPEND_FIELD(jump_progress, SUSPEND_FLIP_ZIP),
+    SUSPEND_FIELD(jump_scale, SUSPEND_FLIP_ZIP),
+    SUSPEND_FIELD(jump_height, SUSPEND_FLIP_ZIP),
+    SUSPEND_FIELD(jump_y_accumulated, SUSPEND_FLIP_ZIP),
+    SUSPEND_FIELD(successful_jumps, SUSPEND_FLIP_ZIP),
+    // Line Car and Flip IQ
+    SUSPEND_FIELD(car_lane, SUSPEND_LINE_CAR | SUSPEND_FLIP_IQ),
+    SUSPEND_FIELD(car_y, SUSPEND_LINE_CAR | SUSPEND_FLIP_IQ),
+    SUSPEND_FIELD(car_angle, SUSPEND_LINE_CAR),
+    SUSPEND_FIELD(prev_car_lane, SUSPEND_LINE_CAR),
+    SUSPEND_FIELD(uber_points, SUSPEND_LINE_CAR),
+    SUSPEND_FIELD(drift_multiplier, SUSPEND_LINE_CAR),
+    SUSPEND_FIELD(is_drifting, SUSPEND_LINE_CAR),
+    SUSPEND_FIELD(fast_line, SUSPEND_LINE_CAR),
+    SUSPEND_FIELD(slow_line, SUSPEND_LINE_CAR),
+    SUSPEND_FIELD(track, SUSPEND_LINE_CAR),
+    SUSPEND_TIME(last_drift_time, SUSPEND_LINE_CAR),
+    SUSPEND_FIELD(ball_width, SUSPEND_FLIP_IQ),
+    SUSPEND_FIELD(active_lanes, SUSPEND_FLIP_IQ),
+    SUSPEND_FIELD(ball_count, SUSPEND_FLIP_IQ),
+    SUSPEND_TIME(round_start_time, SUSPEND_FLIP_IQ),
+    // Tectone Sim
+    SUSPEND_FIELD(emotions, SUSPEND_TECTONE_SIM),
+    SUSPEND_FIELD(tectone_action, SUSPEND_TECTONE_SIM),
+    SUSPEND_FIELD(tectone_prop, SUSPEND_TECTONE_SIM),
+    SUSPEND_FIELD(tectone_x, SUSPEND_TECTONE_SIM),
+    SUSPEND_FIELD(move_cooldown, SUSPEND_TECTONE_SIM),
+    SUSPEND_FIELD(hype_train, SUSPEND_TECTONE_SIM),
+    SUSPEND_FIELD(last_comment_side, SUSPEND_TECTONE_SIM),
+    SUSPEND_FIELD(same_side_count, SUSPEND_TECTONE_SIM),
+    SUSPEND_FIELD(hype_cooldown, SUSPEND_TECTONE_SIM), // Only tested for zero
+    SUSPEND_TIME(emotion_cooldown, SUSPEND_TECTONE_SIM),
+    SUSPEND_TIME(tectone_action_until, SUSPEND_TECTONE_SIM),
+    SUSPEND_TIME(last_move_time, SUSPEND_TECTONE_SIM),
+    // Space Flight
+    SUSPEND_FIELD(ship_health, SUSPEND_SPACE_FLIGHT),
+    SUSPEND_FIELD(ship_armor, SUSPEND_SPACE_FLIGHT),
+    SUSPEND_FIELD(screen_type, SUSPEND_SPACE_FLIGHT),
+    SUSPEND_FIELD(combo_state, SUSPEND_SPACE_FLIGHT),
+    SUSPEND_TIME(last_sequence_time, SUSPEND_SPACE_FLIGHT),
+    SUSPEND_TIME(combo_time, SUSPEND_SPACE_FLIGHT),
+};
+
+// Snapshot bytes after the header for one game
+static size_t suspend_size(GameMode mode) {
+    size_t size = mode == GAME_MODE_TECTONE_SIM ? SUSPEND_COMMENT_BYTES : 0;
+    for(size_t i = 0; i < COUNT_OF(suspend_fields); i++) {
+        if(suspend_fields[i].modes & SUSPEND_MODE(mode)) size += suspend_fields[i].size;
+    }
+    return size;
+}
+
+// Save the paused game on the way out, once the timer has stopped. The buffer
+// comes from the game's arena, which nothing else uses by then.
+static bool game_suspend(GameContext* ctx, uint32_t now) {
+    GameMode mode = ctx->selected_game;
+    size_t size = suspend_size(mode);
+    size_t mark = arena_mark(&ctx->arena);
+    uint8_t* buffer = arena_alloc(&ctx->arena, sizeof(SuspendHeader) + size);
+    if(!buffer) return false;
+    SuspendHeader header = {SUSPEND_MAGIC, SUSPEND_VERSION, mode, size};
+    memcpy(buffer, &header, sizeof(header));
+    uint8_t* out = buffer + sizeof(header);
+    for(size_t i = 0; i < COUNT_OF(suspend_fields); i++) {
+        const SuspendField* field = &suspend_fields[i];
+        if(!(field->modes & SUSPEND_MODE(mode))) continue;
+        const uint8_t* value = (const uint8_t*)ctx + field->offset;
+        if(field->time) {
+            uint32_t age = now - *(const uint32_t*)value;
+            memcpy(out, &age, sizeof(age));
+        } else {
+            memcpy(out, value, field->size);
         }
-        sam_say(&voice, upper_text);
-        furi_hal_speaker_release();
+        out += field->size;
     }
+    if(mode == GAME_MODE_TECTONE_SIM && ctx->comments) memcpy(out, ctx->comments, SUSPEND_COMMENT_BYTES);
+    bool saved = save_write(SUSPEND_PATH, SUSPEND_TEMP_PATH, buffer, sizeof(header) + size);
+    arena_rewind(&ctx->arena, mark);
+    return saved;
+}
+
+// Restore a suspended game straight into pause with a single read. The files
+// are removed either way, so a bad or stale snapshot is never retried.
+static bool game_resume(GameContext* ctx, uint32_t now) {
+    size_t largest = 0;
+    for(int mode = 0; mode < GAME_MODE_COUNT; mode++) {
+        if(suspend_size(mode) > largest) largest = suspend_size(mode);
+    }
+    game_arena_enter(ctx, GAME_MODE_COUNT);
+    // Tectone chat needs its slot below the read buffer, so it outlives it
+    TectoneComment* comments = arena_alloc(&ctx->arena, SUSPEND_COMMENT_BYTES);
+    size_t mark = arena_mark(&ctx->arena);
+    uint8_t* buffer = arena_alloc(&ctx->arena, sizeof(SuspendHeader) + largest);
+    if(!comments || !buffer) return false;
+    // A stop between the temp write and the rename leaves only the temp file
+    size_t read = save_read_any(SUSPEND_PATH, SUSPEND_TEMP_PATH, buffer, sizeof(SuspendHeader) + largest);
+    if(read) {
+        save_remove(SUSPEND_PATH);
+        save_remove(SUSPEND_TEMP_PATH);
+    }
+    SuspendHeader header;
+    memcpy(&header, buffer, sizeof(header));
+    bool valid = read >= sizeof(header) && header.magic == SUSPEND_MAGIC && header.version == SUSPEND_VERSION &&
+                 header.mode < GAME_MODE_COUNT && header.size == suspend_size(header.mode) &&
+                 read == sizeof(header) + header.size;
+    if(!valid || !game_built_in(header.mode)) {
+        game_arena_enter(ctx, GAME_MODE_COUNT);
+        return false;
+    }
+
+    const uint8_t* in = buffer + sizeof(header);
+    for(size_t i = 0; i < COUNT_OF(suspend_fields); i++) {
+        const SuspendField* field = &suspend_fields[i];
+        if(!(field->modes & SUSPEND_MODE(header.mode))) continue;
+        uint8_t* value = (uint8_t*)ctx + field->offset;
+        if(field->time) {
+            uint32_t age;
+            memcpy(&age, in, sizeof(age));
+            *(uint32_t*)value = now - age;
+        } else {
+            memcpy(value, in, field->size);
+        }
+        in += field->size;
+    }
+    pool_rebuild(&ctx->pool);
+    track_rebuild(&ctx->track, PORTRAIT_HEIGHT);
+    arena_rewind(&ctx->arena, mark);
+    if(header.mode == GAME_MODE_TECTONE_SIM) {
+        memcpy(comments, in, SUSPEND_COMMENT_BYTES);
+        ctx->comments = comments;
+    } else {
+        game_arena_enter(ctx, GAME_MODE_COUNT); // Drop the unused chat slot
+    }
+    ctx->arena_mode = header.mode;
+    ctx->selected_game = header.mode;
+    ctx->state = GAME_STATE_PAUSE;
+    return true;
+}
+
+#if NAH_TECTONE_SIM
+// Queue a phrase for the speech worker, the tick never waits on audio
+static void tectone_say(TtsPhrase phrase) {
+    #if USE_SAM_TTS
+    tts_say(&speech, phrase);
+    #else
+    UNUSED(phrase);
+    #endif // USE_SAM_TTS
+}
+#endif // NAH_TECTONE_SIM
+
+#if NAH_FLIP_IQ
+// Highest the player can climb, the top of the remaining lanes
+static int flip_iq_top(const GameContext* ctx) {
+    return 46 + (5 - ctx->active_lanes) * 6;
+}
+
+// Player knocked below the floor of the game board by stumbles
+static bool flip_iq_dead(const GameContext* ctx) {
+    return ctx->car_y > PORTRAIT_HEIGHT - 7;
+}
+
+// Round number from the streak, 1 before the first round ends and after a stumble
+static int flip_iq_round(const GameContext* ctx) {
+    return ctx->streak < 1 ? 1 : ctx->streak;
+}
+
+// Ball width for a new round, 10 pixels plus up to one per round, 19 at most
+static int flip_iq_ball_width(GameContext* ctx) {
+    int round = flip_iq_round(ctx);
+    return game_rand(ctx) % (round > 10 ? 10 : round) + 10;
+}
+
+// Round ball falls from the background top in the middle lane, outside the cap
+static void flip_iq_round_ball(GameContext* ctx) {
+    uint8_t id = pool_spawn(&ctx->pool, 2);
+    if(id == POOL_NONE) return;
+    ctx->pool.y[id] = 26; // Start at background top
+    ctx->pool.size[id] = ctx->ball_width;
+    ctx->pool.type[id] = BALL_DROP;
+}
+
+static bool flip_iq_round_ball_falling(const GameContext* ctx) {
+    for(int i = 0; i < ctx->pool.count; i++) {
+        if(ctx->pool.type[ctx->pool.active[i]] & BALL_DROP) return true;
+    }
+    return false;
 }
-#endif // USE_SAM_TTS
 
 // Update Flip IQ game
 static void update_flip_iq(GameContext* ctx) {
     if(!ctx) return;
-    int fps = FPS_BASE + (ctx->speed_bpm > 0 ? ctx->speed_bpm / 10 : 0);
+    int fps = ctx->tuning.fps_base + (ctx->speed_bpm > 0 ? ctx->speed_bpm / 10 : 0);
     if(furi_get_tick() - ctx->last_ai_update < (uint32_t)(1000 / fps)) return;
     ctx->last_ai_update = furi_get_tick();
-    int speed_modifier = ctx->speed_bpm / 78; // Base speed at 78 BPM
+    fx_t speed = fx_ratio(ctx->speed_bpm, FX_RECIP32(BASE_BPM)); // 1.0 at base BPM
     // Adjust speed based on streak and misses
     if(ctx->streak > 0 && furi_get_tick() - ctx->last_ai_update > 150) {
-        ctx->speed_bpm += (ctx->speed_bpm * 0.01 < 700) ? 1 : 0; // Max 700% increase
+        ctx->speed_bpm += (speed < SPEED_SCALE_MAX) ? 1 : 0; // Max 700% increase
     } else if(ctx->streak == 0 && furi_get_tick() - ctx->last_ai_update > 199) {
-        ctx->speed_bpm -= (ctx->speed_bpm * 0.01 > 66) ? 1 : 0; // Min 66% decrease
-    }
-
-    // Handle initial ball drop and round start
-    if(ctx->game_start_time == 0) {
-        ctx->game_start_time = furi_get_tick(); // Start timer
-        ctx->round_start_time = furi_get_tick();
-        ctx->ball_width = (rand() % (ctx->streak > 10 ? 10 : ctx->streak) + 10); // 10-20 pixels
-        ctx->key_columns[2][0] = ctx->ball_width;
-        ctx->key_positions[2][0] = 26; // Start at background top
-        ctx->active_lanes = 5; // Start with all lanes
-        ctx->ball_count = ctx->ball_width * 6; // Max balls based on width
-        int miss_percent = rand() % 21; // 0-20% missed balls
-        ctx->ball_count -= (ctx->ball_count * miss_percent) / 100;
-        ctx->ball_count = ctx->ball_count > WORLD_OBJ_LIMIT ? WORLD_OBJ_LIMIT : ctx->ball_count; // Cap at global limit
-        // Comment: Adjust WORLD_OBJ_LIMIT or miss_percent for performance/difficulty tuning
+        ctx->speed_bpm -= (speed > SPEED_SCALE_MIN) ? 1 : 0; // Min 66% decrease
     }
 
     uint32_t elapsed = (furi_get_tick() - ctx->round_start_time) / 1000;
-    uint32_t round_time = 30 + (ctx->streak - 1) * 30; // 30s + 30s per round
-    if(elapsed > round_time - 9 && ctx->key_positions[2][0] == 0) {
+    uint32_t round_time = 30 + (flip_iq_round(ctx) - 1) * 30; // 30s + 30s per round
+    if(elapsed > round_time - 9 && !flip_iq_round_ball_falling(ctx)) {
         ctx->score += 10; // Round end bonus
-        snprintf(ctx->notification_text, sizeof(ctx->notification_text), "Round End. +10 PP");
-        ctx->last_notification_time = furi_get_tick();
-        ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
+        notify_push(&ctx->notify, "Round End. +10 PP", NOTIFY_HIGH, furi_get_tick());
         ctx->streak++; // Increment streak
         if(ctx->streak > 99) ctx->streak = 1; // Loop back to 1
         ctx->round_start_time = furi_get_tick(); // Reset for next round
-        ctx->ball_width = (rand() % (ctx->streak > 10 ? 10 : ctx->streak) + 10); // New ball width
-        ctx->key_columns[2][0] = ctx->ball_width;
-        ctx->key_positions[2][0] = 26;
-        ctx->ball_count = ctx->ball_width * 6 * (100 - (rand() % 21)) / 100; // Recalculate with miss percent
+        ctx->ball_width = flip_iq_ball_width(ctx); // New ball width
+        flip_iq_round_ball(ctx);
+        ctx->ball_count = ctx->ball_width * 6 * (100 - (game_rand(ctx) % 21)) / 100; // Recalculate with miss percent
         ctx->ball_count = ctx->ball_count > WORLD_OBJ_LIMIT ? WORLD_OBJ_LIMIT : ctx->ball_count;
         // Comment: Adjust ball_count or miss_percent for difficulty tuning
     }
 
-    // Move and spawn balls
-    for(int i = 0; i < 5; i++) {
-        for(int j = 0; j < WORLD_OBJ_LIMIT; j++) {
-            if(ctx->key_positions[i][j] > 0) {
-                ctx->key_positions[i][j] += speed_modifier;
-                if(ctx->key_positions[i][j] > 46 && ctx->key_positions[i][j] < 46 + 20 && rand() % 4 == 0) {
-                    ctx->ball_broken[j] = true; // 25% break chance
-                }
-                if(ctx->key_positions[i][j] > PORTRAIT_HEIGHT - 7) {
-                    ctx->key_positions[i][j] = 0;
-                    ctx->key_columns[i][j] = 0;
-                    if(i == ctx->car_lane && ctx->car_y + 3 >= ctx->key_positions[i][j] - ctx->key_columns[i][j]) {
-                        if(ctx->ball_broken[j] && ctx->is_holding[0]) {
-                            ctx->car_y -= ctx->key_columns[i][j]; // Climb over
-                            ctx->score += 1; // Add to hidden PP score
-                            int msg_idx = rand() % (sizeof(flip_iq_notifications_positive) / sizeof(flip_iq_notifications_positive[0]));
-                            strcpy(ctx->notification_text, flip_iq_notifications_positive[msg_idx]);
-                            ctx->last_notification_time = furi_get_tick();
-                            ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
-                        } else {
-                            ctx->streak = 0; // Stumble
-                            int msg_idx = rand() % (sizeof(flip_iq_notifications_negative) / sizeof(flip_iq_notifications_negative[0]));
-                            strcpy(ctx->notification_text, flip_iq_notifications_negative[msg_idx]);
-                            ctx->last_notification_time = furi_get_tick();
-                            ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
-                        }
-                    }
-                }
-            }
+    // Balls fall under gravity up to a speed set by the BPM, never under the 66% floor
+    EntityPool* pool = &ctx->pool;
+    int16_t terminal = (speed > SPEED_SCALE_MIN ? speed : SPEED_SCALE_MIN) >> (FX_SHIFT - POOL_SUBPX_SHIFT);
+    int16_t gravity = terminal / FLIP_IQ_FALL_TICKS + 1;
+    for(int i = pool->count - 1; i >= 0; i--) {
+        uint8_t id = pool->active[i];
+        pool_fall(pool, id, gravity, terminal);
+        if(pool->y[id] > 46 && pool->y[id] < 46 + 20 && game_rand(ctx) % 4 == 0) {
+            pool->type[id] |= BALL_BROKEN; // 25% break chance
+        }
+        if(pool->y[id] > PORTRAIT_HEIGHT - 7) pool_kill(pool, id); // Fell past the player
+    }
+    // Only balls in the player's lane can reach it. A ball spans its width
+    // above y, plus the step it just fell, so a fast one cannot pass through.
+    PoolBuckets buckets;
+    pool_bucket(pool, &buckets);
+    for(int i = buckets.start[ctx->car_lane]; i < buckets.start[ctx->car_lane + 1]; i++) {
+        uint8_t id = buckets.ids[i];
+        int top = pool->y[id] - pool->size[id] - (pool->vy[id] >> POOL_SUBPX_SHIFT) - 1;
+        if(pool->y[id] < ctx->car_y - 1 || top > ctx->car_y + 3) continue;
+        int width = pool->size[id];
+        bool broken = pool->type[id] & BALL_BROKEN;
+        pool_kill(pool, id);
+        if(broken && ctx->is_holding[0]) {
+            ctx->car_y -= width; // Climb over
+            if(ctx->car_y < flip_iq_top(ctx)) ctx->car_y = flip_iq_top(ctx);
+            ctx->score += 1; // Add to hidden PP score
+            int msg_idx = game_rand(ctx) % (sizeof(flip_iq_notifications_positive) / sizeof(flip_iq_notifications_positive[0]));
+            notify_push(&ctx->notify, flip_iq_notifications_positive[msg_idx], NOTIFY_NORMAL, furi_get_tick());
+        } else {
+            ctx->streak = 0; // Stumble
+            ctx->car_y += width; // Knocked down, past the floor ends the game
+            int msg_idx = game_rand(ctx) % (sizeof(flip_iq_notifications_negative) / sizeof(flip_iq_notifications_negative[0]));
+            notify_push(&ctx->notify, flip_iq_notifications_negative[msg_idx], NOTIFY_NORMAL, furi_get_tick());
         }
     }
     // Comment: Adjust spawn rate or lane change frequency for difficulty
-    if(ctx->ai_beat_counter++ % 15 == 0 && ctx->ball_count > 0) {
-        int lane = rand() % ctx->active_lanes;
-        for(int j = 0; j < WORLD_OBJ_LIMIT; j++) {
-            if(ctx->key_positions[lane][j] == 0) {
-                ctx->key_positions[lane][j] = 46; // Start at game board top
-                ctx->key_columns[lane][j] = ctx->ball_width;
+    if(ctx->ai_beat_counter++ % ctx->tuning.ball_spawn_ticks == 0 && ctx->ball_count > 0) {
+        int lane = game_rand(ctx) % ctx->active_lanes;
+        if(pool->lane_count[lane] < game_cap(ctx, WORLD_OBJ_LIMIT)) {
+            uint8_t id = pool_spawn(pool, lane);
+            if(id != POOL_NONE) {
+                pool->y[id] = 46; // Start at game board top
+                pool->size[id] = ctx->ball_width;
                 ctx->ball_count--;
-                break;
             }
         }
     }
+    // Death screen is drawn from the snapshot, leave once the notifications have played out
+    if(flip_iq_dead(ctx) && furi_get_tick() - ctx->game_start_time >= GAME_TITLE_MS && !notify_front(&ctx->notify)) {
+        ctx->score += ctx->score; // Add PP to total score
+        ctx->state = GAME_STATE_TITLE;
+    }
+}
+#endif // NAH_FLIP_IQ
+
+#if NAH_TECTONE_SIM || NAH_SPACE_FLIGHT
+// Start a vibro pattern; haptic_tick plays it from the timer so no thread sleeps.
+// Edges land on timer ticks, so short pulses stretch to one tick.
+static void haptic_start(GameContext* ctx, uint8_t pulses, uint16_t on_ms, uint16_t off_ms, uint32_t now) {
+    if(ctx->haptic_on) furi_hal_vibro_on(false);
+    ctx->haptic_pulses = pulses;
+    ctx->haptic_on = false;
+    ctx->haptic_on_ms = on_ms;
+    ctx->haptic_off_ms = off_ms;
+    ctx->haptic_next = now;
+}
+#endif // NAH_TECTONE_SIM || NAH_SPACE_FLIGHT
+
+static void haptic_tick(GameContext* ctx, uint32_t now) {
+    if(ctx->haptic_pulses == 0 || (int32_t)(now - ctx->haptic_next) < 0) return;
+    ctx->haptic_on = !ctx->haptic_on;
+    furi_hal_vibro_on(ctx->haptic_on);
+    if(ctx->haptic_on) {
+        ctx->haptic_next = now + ctx->haptic_on_ms;
+    } else {
+        ctx->haptic_pulses--;
+        ctx->haptic_next = now + ctx->haptic_off_ms;
+    }
+}
+
+#if NAH_TECTONE_SIM
+// Tectone transition: fires when an emotion reaches its edge
+#define TECTONE_OUTCOMES_MAX 5
+typedef struct {
+    TectoneEmotion emotion;
+    uint8_t edge;
+    uint8_t reset; // Level the emotion falls back to
+    TectoneEmotion partner; // Emotion moved along with it
+    int8_t partner_set; // New partner level, -1 to add partner_add instead
+    int8_t partner_add;
+    TtsRow rows[2]; // Phrase row, picked at random; TTS_ROW_COUNT for no phrase
+    uint8_t outcomes; // Phrase index and action are drawn together
+    TectoneAction actions[TECTONE_OUTCOMES_MAX];
+} TectoneTransition;
+
+// Checked in order, the first match is the only one that fires
+static const TectoneTransition tectone_transitions[] = {
+    {TECTONE_ANGER, 0, 5, TECTONE_CUTE, 3, 0, {TTS_ROW_CUTE, TTS_ROW_CUTE}, 4, {0}},
+    {TECTONE_ANGER, 9, 5, TECTONE_CUTE, 3, 0, {TTS_ROW_ANGER, TTS_ROW_ANGER}, 4, {TECTONE_ACTION_SLAM_DESK}},
+    {TECTONE_BASED, 0, 7, TECTONE_SAD, 4, 0, {TTS_ROW_SAD, TTS_ROW_SAD}, 4, {0}},
+    {TECTONE_BASED, 9, 7, TECTONE_SAD, 4, 0, {TTS_ROW_BASED, TTS_ROW_BASED}, 4, {TECTONE_ACTION_NONE, TECTONE_ACTION_PUMP_GUN}},
+    {TECTONE_CUTE, 0, 3, TECTONE_BASED, -1, 1, {TTS_ROW_BASED, TTS_ROW_ANGER}, 4, {0}},
+    {TECTONE_CUTE, 9, 3, TECTONE_BASED, -1, 1, {TTS_ROW_CUTE, TTS_ROW_CUTE}, 4, {0}},
+    {TECTONE_SAD, 0, 4, TECTONE_ANGER, -1, 1, {TTS_ROW_BASED, TTS_ROW_BASED}, 4, {0}},
+    {TECTONE_SAD, 9, 4, TECTONE_ANGER, -1, 1, {TTS_ROW_COUNT, TTS_ROW_COUNT}, 5,
+     {TECTONE_ACTION_GO_TO_BED, TECTONE_ACTION_EXIT_SCREEN, TECTONE_ACTION_LIGHTS_OFF, TECTONE_ACTION_BEEP, TECTONE_ACTION_HIDE_CHAT}},
+};
+
+// Length and notification per action, indexed by TectoneAction
+static const struct {
+    uint32_t ms; // 0 for actions that end at once
+    const char* notification;
+} tectone_actions[] = {
+    [TECTONE_ACTION_NONE] = {0, NULL},
+    [TECTONE_ACTION_SLAM_DESK] = {0, "*Slams desk*"},
+    [TECTONE_ACTION_PUMP_GUN] = {0, "*Pumps gun*"},
+    [TECTONE_ACTION_BEEP] = {15000, "Beep beep"},
+    [TECTONE_ACTION_GO_TO_BED] = {45000, "Gone to bed"},
+    [TECTONE_ACTION_ASLEEP] = {30000, "Lights out"},
+    [TECTONE_ACTION_EXIT_SCREEN] = {8000, "BRB"},
+    [TECTONE_ACTION_LIGHTS_OFF] = {30000, "Lights out"},
+    [TECTONE_ACTION_HIDE_CHAT] = {45000, "Chat hidden"},
+};
+
+// What one transition asks of speech, vibro and the notification line
+typedef struct {
+    TtsPhrase phrase;
+    TectoneAction action;
+    uint8_t pulses; // Vibro pulses, 0 for none
+    uint16_t pulse_ms;
+    uint16_t gap_ms;
+} TectoneEvent;
+
+static void tectone_nudge(GameContext* ctx, TectoneEmotion emotion, int delta) {
+    int level = ctx->emotions[emotion] + delta;
+    ctx->emotions[emotion] = level < 0 ? 0 : level > TECTONE_EMOTION_MAX ? TECTONE_EMOTION_MAX : level;
+}
+
+static bool tectone_away(const GameContext* ctx) {
+    return ctx->tectone_action == TECTONE_ACTION_GO_TO_BED || ctx->tectone_action == TECTONE_ACTION_ASLEEP ||
+           ctx->tectone_action == TECTONE_ACTION_EXIT_SCREEN;
+}
+
+static void tectone_action_start(GameContext* ctx, TectoneAction action, uint32_t now) {
+    if(action == TECTONE_ACTION_GO_TO_BED || action == TECTONE_ACTION_EXIT_SCREEN) {
+        ctx->tectone_x = -10; // Off-screen
+    } else if(action == TECTONE_ACTION_ASLEEP || action == TECTONE_ACTION_LIGHTS_OFF) {
+        ctx->is_day = false;
+    } else if(action == TECTONE_ACTION_HIDE_CHAT) {
+        pool_clear(&ctx->pool);
+    }
+    if(tectone_actions[action].notification) {
+        notify_push(&ctx->notify, tectone_actions[action].notification, NOTIFY_NORMAL, now);
+    }
+    ctx->tectone_action = tectone_actions[action].ms ? action : TECTONE_ACTION_NONE;
+    ctx->tectone_action_until = now + tectone_actions[action].ms;
+}
+
+// End the running action once its time is up
+static void tectone_action_tick(GameContext* ctx, uint32_t now) {
+    if(ctx->tectone_action == TECTONE_ACTION_NONE || (int32_t)(now - ctx->tectone_action_until) < 0) return;
+    TectoneAction ended = ctx->tectone_action;
+    ctx->tectone_action = TECTONE_ACTION_NONE;
+    if(ended == TECTONE_ACTION_GO_TO_BED) {
+        tectone_action_start(ctx, TECTONE_ACTION_ASLEEP, now);
+        return;
+    }
+    if(ended == TECTONE_ACTION_ASLEEP || ended == TECTONE_ACTION_LIGHTS_OFF) ctx->is_day = true; // Lights on
+    if(ended == TECTONE_ACTION_ASLEEP || ended == TECTONE_ACTION_EXIT_SCREEN) ctx->tectone_x = PORTRAIT_WIDTH / 2 - 3;
+}
+
+// Apply the first transition on its edge; false when none fired or an action is still running
+static bool tectone_step(GameContext* ctx, TectoneEvent* event) {
+    if(ctx->tectone_action != TECTONE_ACTION_NONE) return false;
+    const TectoneTransition* t = NULL;
+    for(size_t i = 0; i < sizeof(tectone_transitions) / sizeof(tectone_transitions[0]) && !t; i++) {
+        if(ctx->emotions[tectone_transitions[i].emotion] == tectone_transitions[i].edge) t = &tectone_transitions[i];
+    }
+    if(!t) return false;
+    ctx->emotions[t->emotion] = t->reset;
+    if(t->partner_set >= 0) ctx->emotions[t->partner] = t->partner_set;
+    else tectone_nudge(ctx, t->partner, t->partner_add);
+
+    TtsRow row = t->rows[0] == t->rows[1] ? t->rows[0] : t->rows[game_rand(ctx) % 2];
+    uint8_t outcome = game_rand(ctx) % t->outcomes;
+    event->action = t->actions[outcome];
+    event->phrase = row != TTS_ROW_COUNT ? TTS_PHRASE_EMOTION(row, outcome) :
+                    event->action == TECTONE_ACTION_BEEP ? TTS_PHRASE_BEEP : TTS_PHRASE_NONE;
+    event->pulses = 0;
+    event->pulse_ms = 0;
+    event->gap_ms = 0;
+    if(event->action == TECTONE_ACTION_SLAM_DESK) {
+        event->pulses = game_rand(ctx) % 15 + 1;
+        event->pulse_ms = 32;
+        event->gap_ms = 50;
+    } else if(event->action == TECTONE_ACTION_PUMP_GUN) {
+        event->pulses = 1;
+        event->pulse_ms = 700;
+    }
+    return true;
+}
+
+static void tectone_emit(GameContext* ctx, const TectoneEvent* event, uint32_t now) {
+    if(event->phrase != TTS_PHRASE_NONE) tectone_say(event->phrase);
+    if(event->pulses) haptic_start(ctx, event->pulses, event->pulse_ms, event->gap_ms, now);
+    if(event->action != TECTONE_ACTION_NONE) tectone_action_start(ctx, event->action, now);
+}
+
+// Pick the words of a new comment. The draw wraps them with the font's widths,
+// each word measured once through text_cache.
+static void tectone_comment_spawn(GameContext* ctx, TectoneComment* comment) {
+    comment->words[0] = game_rand(ctx) % COUNT_OF(tectone_starters);
+    comment->words[1] = game_rand(ctx) % COUNT_OF(tectone_subjects);
+    comment->words[2] = game_rand(ctx) % COUNT_OF(tectone_climaxes);
+    comment->words[3] = game_rand(ctx) % COUNT_OF(tectone_endpoints);
 }
 
 // Update Tectone Sim game
 static void update_tectone_sim(GameContext* ctx) {
     if(!ctx) return;
-    int fps = FPS_BASE + (ctx->speed_bpm > 0 ? ctx->speed_bpm / 10 : 0);
-    if(furi_get_tick() - ctx->last_ai_update < (uint32_t)(1000 / fps)) return;
-    ctx->last_ai_update = furi_get_tick();
-    int speed_modifier = ctx->speed_bpm / 58; // Base speed at 58 BPM
+    int fps = ctx->tuning.fps_base + (ctx->speed_bpm > 0 ? ctx->speed_bpm / 10 : 0);
+    uint32_t now = furi_get_tick();
+    if(now - ctx->last_ai_update < (uint32_t)(1000 / fps)) return;
+    ctx->last_ai_update = now;
+    int speed_modifier = fx_to_int(fx_ratio(ctx->speed_bpm, FX_RECIP32(TECTONE_BASE_BPM))); // Base speed at 58 BPM
     // Comment: Adjust base BPM (58) for comment scroll speed tuning
 
     // Handle emotion updates
-    if(furi_get_tick() - ctx->emotion_cooldown > 1000) {
-        if(ctx->is_holding[1] && ctx->anger < 9) { // Left: Anger
-            ctx->anger++;
-            ctx->emotion_cooldown = furi_get_tick();
-        } else if(ctx->is_holding[0] && ctx->based < 9) { // Up: Based
-            ctx->based++;
-            ctx->emotion_cooldown = furi_get_tick();
-        } else if(ctx->is_holding[3] && ctx->cuteness < 9) { // Right: Cuteness
-            ctx->cuteness++;
-            ctx->emotion_cooldown = furi_get_tick();
+    if(now - ctx->emotion_cooldown > 1000) {
+        if(ctx->is_holding[1]) { // Left: Anger
+            tectone_nudge(ctx, TECTONE_ANGER, 1);
+            ctx->emotion_cooldown = now;
+        } else if(ctx->is_holding[0]) { // Up: Based
+            tectone_nudge(ctx, TECTONE_BASED, 1);
+            ctx->emotion_cooldown = now;
+        } else if(ctx->is_holding[3]) { // Right: Cuteness
+            tectone_nudge(ctx, TECTONE_CUTE, 1);
+            ctx->emotion_cooldown = now;
         } else if(ctx->is_holding[4]) { // Down: Prop
-            ctx->emotion_cooldown = furi_get_tick();
-            int prop = rand() % 3; // 0: Microphone, 1: Shotgun, 2: Ball
-            if(prop == 0) { // Microphone
-                ctx->anger += rand() % 2 ? 1 : -1;
-                if(ctx->anger < 0) ctx->anger = 0;
-                if(ctx->anger > 9) ctx->anger = 9;
-            } else if(prop == 1) { // Shotgun
-                ctx->based += rand() % 2 ? 1 : -1;
-                if(ctx->based < 0) ctx->based = 0;
-                if(ctx->based > 9) ctx->based = 9;
-                furi_hal_vibro_on(true);
-                furi_delay_ms(32);
-                furi_hal_vibro_on(false);
-            } else { // Ball
-                ctx->cuteness += rand() % 2 ? 1 : -1;
-                if(ctx->cuteness < 0) ctx->cuteness = 0;
-                if(ctx->cuteness > 9) ctx->cuteness = 9;
-            }
+            ctx->emotion_cooldown = now;
+            ctx->tectone_prop = game_rand(ctx) % 3; // 0: Microphone, 1: Shotgun, 2: Ball
+            static const TectoneEmotion prop_emotions[] = {TECTONE_ANGER, TECTONE_BASED, TECTONE_CUTE};
+            tectone_nudge(ctx, prop_emotions[ctx->tectone_prop], game_rand(ctx) % 2 ? 1 : -1);
+            if(ctx->tectone_prop == 1) haptic_start(ctx, 1, 32, 0, now); // Shotgun kick
         } else if(ctx->is_holding[2]) { // OK: Random emotion
-            int emotion = rand() % 4;
-            if(emotion == 0) ctx->anger += (ctx->anger < 9) ? 1 : 0;
-            else if(emotion == 1) ctx->based += (ctx->based < 9) ? 1 : 0;
-            else if(emotion == 2) ctx->cuteness += (ctx->cuteness < 9) ? 1 : 0;
-            else ctx->sad += (ctx->sad < 9) ? 1 : 0;
-            ctx->emotion_cooldown = furi_get_tick();
-        }
-    }
-
-    // Emotion thresholds and actions
-    char phrase_buffer[32]; // Buffer to store selected phrase
-    if(ctx->anger == 0) {
-        ctx->cuteness = 3; // Reset cuteness
-        ctx->anger = 5; // Reset anger
-        int idx = rand() % 4;
-        strncpy(phrase_buffer, tectone_emotion_phrases[1][idx], sizeof(phrase_buffer) - 1); // Cuteness phrase
-        phrase_buffer[sizeof(phrase_buffer) - 1] = '\0';
-        #if USE_SAM_TTS
-        SAMT2S(phrase_buffer);
-        #endif
-    } else if(ctx->anger == 9) {
-        ctx->cuteness = 3; // Reset cuteness
-        ctx->anger = 5; // Reset anger
-        int idx = rand() % 4;
-        strncpy(phrase_buffer, tectone_emotion_phrases[2][idx], sizeof(phrase_buffer) - 1); // Anger phrase
-        phrase_buffer[sizeof(phrase_buffer) - 1] = '\0';
-        #if USE_SAM_TTS
-        SAMT2S(phrase_buffer);
-        #endif
-        if(idx == 0) { // Slam desk
-            int slams = rand() % 15 + 1;
-            for(int i = 0; i < slams; i++) {
-                furi_hal_vibro_on(true);
-                furi_delay_ms(32);
-                furi_hal_vibro_on(false);
-                furi_delay_ms(50);
-            }
-        }
-    }
-    if(ctx->based == 0) {
-        ctx->sad = 4; // Reset sad
-        ctx->based = 7; // Reset based
-        int idx = rand() % 4;
-        strncpy(phrase_buffer, tectone_emotion_phrases[3][idx], sizeof(phrase_buffer) - 1); // Sad phrase
-        phrase_buffer[sizeof(phrase_buffer) - 1] = '\0';
-        #if USE_SAM_TTS
-        SAMT2S(phrase_buffer);
-        #endif
-    } else if(ctx->based == 9) {
-        ctx->sad = 4; // Reset sad
-        ctx->based = 7; // Reset based
-        int idx = rand() % 4;
-        strncpy(phrase_buffer, tectone_emotion_phrases[0][idx], sizeof(phrase_buffer) - 1); // Based phrase
-        phrase_buffer[sizeof(phrase_buffer) - 1] = '\0';
-        #if USE_SAM_TTS
-        SAMT2S(phrase_buffer);
-        #endif
-        if(idx == 1) { // Pump gun
-            furi_hal_vibro_on(true);
-            furi_delay_ms(700);
-            furi_hal_vibro_on(false);
-        }
-    }
-    if(ctx->cuteness == 0) {
-        ctx->based++; // Increase based
-        ctx->cuteness = 3; // Reset cuteness
-        int idx = rand() % 2 ? 0 : 2;
-        strncpy(phrase_buffer, tectone_emotion_phrases[idx][rand() % 4], sizeof(phrase_buffer) - 1); // Sad or anger phrase
-        phrase_buffer[sizeof(phrase_buffer) - 1] = '\0';
-        #if USE_SAM_TTS
-        SAMT2S(phrase_buffer);
-        #endif
-    } else if(ctx->cuteness == 9) {
-        ctx->based++; // Increase based
-        ctx->cuteness = 3; // Reset cuteness
-        int idx = rand() % 2 ? 1 : rand() % 4; // Cuteness or random
-        strncpy(phrase_buffer, tectone_emotion_phrases[1][idx], sizeof(phrase_buffer) - 1); // Cuteness phrase
-        phrase_buffer[sizeof(phrase_buffer) - 1] = '\0';
-        #if USE_SAM_TTS
-        SAMT2S(phrase_buffer);
-        #endif
-    }
-    if(ctx->sad == 0) {
-        ctx->anger++; // Increase anger
-        ctx->sad = 4; // Reset sad
-        int idx = rand() % 4;
-        strncpy(phrase_buffer, tectone_emotion_phrases[0][idx], sizeof(phrase_buffer) - 1); // Based phrase
-        phrase_buffer[sizeof(phrase_buffer) - 1] = '\0';
-        #if USE_SAM_TTS
-        SAMT2S(phrase_buffer);
-        #endif
-    } else if(ctx->sad == 9) {
-        ctx->anger++; // Increase anger
-        ctx->sad = 4; // Reset sad
-        int idx = rand() % 5;
-        if(idx == 3) { // Beep sounds
-            strncpy(phrase_buffer, "Beep Beep", sizeof(phrase_buffer) - 1);
-            phrase_buffer[sizeof(phrase_buffer) - 1] = '\0';
-            #if USE_SAM_TTS
-            SAMT2S(phrase_buffer);
-            #endif
-            furi_delay_ms(15000);
-        } else if(idx == 0) { // Go to bed
-            ctx->tectone_x = -10; // Off-screen
-            furi_delay_ms(45000);
-            ctx->is_day = false; // Lights off
-            furi_delay_ms(30000);
-            ctx->is_day = true; // Lights on
-            ctx->tectone_x = PORTRAIT_WIDTH / 2 - 3;
-        } else if(idx == 1) { // Exit screen
-            ctx->tectone_x = -10;
-            furi_delay_ms(8000);
-            ctx->tectone_x = PORTRAIT_WIDTH / 2 - 3;
-        } else if(idx == 2) { // Turn off lights
-            ctx->is_day = false;
-            furi_delay_ms(30000);
-            ctx->is_day = true;
-        } else { // Hide chat
-            for(int i = 0; i < WORLD_OBJ_LIMIT; i++) {
-                ctx->comment_positions[i] = 0;
-                ctx->comment_heights[i] = 0;
-            }
-            furi_delay_ms(45000);
+            tectone_nudge(ctx, game_rand(ctx) % TECTONE_EMOTION_COUNT, 1);
+            ctx->emotion_cooldown = now;
         }
     }
 
+    // Emotion thresholds and actions, one transition per tick
+    tectone_action_tick(ctx, now);
+    TectoneEvent event;
+    if(tectone_step(ctx, &event)) tectone_emit(ctx, &event, now);
+
     // Move Tectone
     uint32_t base_move_cooldown = 500; // Base cooldown in ms
-    if(ctx->based > 7 || ctx->sad > 7) base_move_cooldown -= 10; // Faster movement
-    if(furi_get_tick() - ctx->last_move_time > base_move_cooldown) {
-        ctx->tectone_x += (rand() % 2 ? 3 : -3); // Move 3 pixels
+    if(ctx->emotions[TECTONE_BASED] > 7 || ctx->emotions[TECTONE_SAD] > 7) base_move_cooldown -= 10; // Faster movement
+    if(!tectone_away(ctx) && now - ctx->last_move_time > base_move_cooldown) {
+        ctx->tectone_x += (game_rand(ctx) % 2 ? 3 : -3); // Move 3 pixels
         if(ctx->tectone_x < 0) ctx->tectone_x = 0;
         if(ctx->tectone_x > PORTRAIT_WIDTH - 10) ctx->tectone_x = PORTRAIT_WIDTH - 10;
-        ctx->last_move_time = furi_get_tick();
+        ctx->last_move_time = now;
         // Comment: Adjust base_move_cooldown or movement range for Tectone's speed
     }
 
     // Handle comments
-    static int last_comment_side = -1;
-    static int same_side_count = 0;
     if(furi_get_tick() - ctx->last_move_time > 1000 && !ctx->hype_cooldown) {
-        int side = rand() % 2; // 0: Twitch (left), 1: YouTube (right)
-        if(last_comment_side == side) same_side_count++;
-        else same_side_count = 0;
-        last_comment_side = side;
-        if(same_side_count >= 3 || (rand() % 4 == 3)) { // Hype train trigger
-            ctx->hype_train[0] = true;
+        int side = game_rand(ctx) % 2; // 0: Twitch (left), 1: YouTube (right)
+        if(ctx->last_comment_side == side) ctx->same_side_count++;
+        else ctx->same_side_count = 0;
+        ctx->last_comment_side = side;
+        if(ctx->same_side_count >= 3 || (game_rand(ctx) % 4 == 3)) { // Hype train trigger
+            ctx->hype_train = true;
             ctx->hype_cooldown = furi_get_tick() + 15000; // 15s cooldown
-            strncpy(phrase_buffer, "HYPE TRAIN", sizeof(phrase_buffer) - 1);
-            phrase_buffer[sizeof(phrase_buffer) - 1] = '\0';
-            #if USE_SAM_TTS
-            SAMT2S(phrase_buffer);
-            #endif
+            tectone_say(TTS_PHRASE_HYPE_TRAIN);
             // Comment: Adjust hype_cooldown or same_side_count threshold for hype train frequency
         }
-        for(int i = 0; i < WORLD_OBJ_LIMIT; i++) {
-            if(ctx->comment_positions[i] > 0) {
-                ctx->comment_positions[i] -= speed_modifier; // Scroll comments upward
-                if(ctx->comment_positions[i] < 0) {
-                    ctx->comment_positions[i] = 0;
-                    ctx->comment_heights[i] = 0;
-                }
-            } else if(rand() % 100 < 10) { // 10% spawn chance
-                ctx->comment_heights[i] = 10; // Fixed height for comments
-                ctx->comment_positions[i] = 47; // Start at bedroom top
-                // Comment: Adjust spawn chance or comment height for visibility
+        EntityPool* pool = &ctx->pool;
+        for(int i = pool->count - 1; i >= 0; i--) {
+            uint8_t id = pool->active[i];
+            pool->y[id] -= speed_modifier; // Scroll comments upward
+            if(pool->y[id] <= 0) pool_kill(pool, id);
+        }
+        int cap = ctx->comments && ctx->tectone_action != TECTONE_ACTION_HIDE_CHAT ? game_cap(ctx, WORLD_OBJ_LIMIT) : 0;
+        for(int i = pool->count; i < cap; i++) {
+            if(game_rand(ctx) % 100 >= 10) continue; // 10% spawn chance for each free place
+            // Under the cap ids stay below WORLD_OBJ_LIMIT, the size of the comment array
+            uint8_t id = pool_spawn(pool, POOL_NO_LANE);
+            if(id == POOL_NONE) break;
+            if(id >= WORLD_OBJ_LIMIT) {
+                pool_kill(pool, id);
                 break;
             }
+            tectone_comment_spawn(ctx, &ctx->comments[id]);
+            pool->size[id] = 10; // Fixed height for comments
+            pool->y[id] = 47; // Start at bedroom top
+            // Comment: Adjust spawn chance or comment height for visibility
+            break;
         }
     }
 }
+#endif // NAH_TECTONE_SIM
+
+#if NAH_SPACE_FLIGHT
+// Maneuvers by key sequence, each switching to the screen_type in its result
+static const ComboSequence space_combos[] = {
+    {{InputKeyUp, InputKeyUp, InputKeyUp, InputKeyUp, InputKeyOk}, 5, 5, SPACE_COMBO_STEP_MS}, // Loop up
+    {{InputKeyUp, InputKeyDown, InputKeyDown, InputKeyDown, InputKeyOk}, 5, 5, SPACE_COMBO_STEP_MS}, // Loop down
+    {{InputKeyLeft, InputKeyLeft, InputKeyLeft, InputKeyLeft, InputKeyLeft}, 5, 6, SPACE_COMBO_STEP_MS}, // Barrel roll left
+    {{InputKeyRight, InputKeyRight, InputKeyRight, InputKeyRight, InputKeyRight}, 5, 6, SPACE_COMBO_STEP_MS}, // Barrel roll right
+};
 
 static void update_space_flight(GameContext* ctx) {
     if(!ctx) return;
-    int fps = FPS_BASE + (ctx->speed_bpm > 0 ? ctx->speed_bpm / 10 : 0);
+    if(ctx->combo_buzz) { // Maneuver from the input thread
+        ctx->combo_buzz = false;
+        haptic_start(ctx, 1, 32, 0, furi_get_tick());
+    }
+    int fps = ctx->tuning.fps_base + (ctx->speed_bpm > 0 ? ctx->speed_bpm / 10 : 0);
     if(furi_get_tick() - ctx->last_ai_update < (uint32_t)(1000 / fps)) return;
     ctx->last_ai_update = furi_get_tick();
-    int speed_modifier = ctx->speed_bpm / 78; // Base speed at 78 BPM
-    // Comment: Adjust base BPM (78) for object scroll speed tuning
+    int speed_modifier = fx_to_int(fx_ratio(ctx->speed_bpm, FX_RECIP32(BASE_BPM))); // Base speed at 78 BPM
+    // Comment: Adjust BASE_BPM for object scroll speed tuning
 
     // Update objects
-    for(int i = 0; i < WORLD_OBJ_LIMIT; i++) {
-        if(ctx->objects[i][2] > 0) { // size > 0
-            ctx->objects[i][1] += speed_modifier; // Move downward by default
-            if(ctx->screen_type == 1) ctx->objects[i][1] -= speed_modifier * 2; // Upward
-            else if(ctx->screen_type == 2) ctx->objects[i][1] += speed_modifier * 2; // Downward
-            else if(ctx->screen_type == 3) ctx->objects[i][0] -= speed_modifier; // Strife left
-            else if(ctx->screen_type == 4) ctx->objects[i][0] += speed_modifier; // Strife right
-            else if(ctx->screen_type == 5 || ctx->screen_type == 6) ctx->objects[i][1] += speed_modifier * 2; // Loop or barrel roll
-            // Scale based on distance
-            ctx->objects[i][2] += speed_modifier / 2;
-            if(ctx->objects[i][2] > PORTRAIT_WIDTH / 3 && ctx->objects[i][2] < PORTRAIT_WIDTH / 2) {
-                int damage = ctx->objects[i][2]; // Damage based on size
-                if(ctx->objects[i][0] > 5 && ctx->objects[i][0] < PORTRAIT_WIDTH - 5 &&
-                   ctx->objects[i][1] > 36 + 13 && ctx->objects[i][1] < 101 - 13) {
-                    if(ctx->screen_type != 0) damage /= 2; // Half damage if moving
-                    if(abs(ctx->objects[i][0] - PORTRAIT_WIDTH / 2) < 5) damage *= 2; // Double damage if centered
-                    if(ctx->ship_armor > 0) ctx->ship_armor -= damage;
-                    else ctx->ship_health -= damage;
-                    if(ctx->ship_health <= 0) {
-                        ctx->ship_health = (rand() % 191) + 9; // Reset health
-                        ctx->ship_armor = (rand() % 81) + 19; // Reset armor
-                        ctx->screen_type = 8; // Dock sequence
-                        ctx->last_sequence_time = furi_get_tick();
-                    }
-                }
-            }
-            if(ctx->objects[i][1] > 101 || ctx->objects[i][1] < 36) ctx->objects[i][2] = 0; // Off-screen
-        } else if(rand() % 100 < 10) { // 10% spawn chance
-            ctx->objects[i][0] = rand() % 64; // Random x
-            ctx->objects[i][1] = 36; // Start above HUD
-            ctx->objects[i][2] = (rand() % 10) + 5; // 5-14 pixel size
-            // Comment: Adjust spawn chance or object size range for difficulty
-            if(ctx->ship_armor == 0 && rand() % 100 < 3) { // 3% health pickup
-                ctx->objects[i][2] = -10; // Negative size for health pickup
-            } else if(rand() % 100 < 25) { // 25% armor pickup
-                ctx->objects[i][2] = -5; // Negative size for armor pickup
+    EntityPool* pool = &ctx->pool;
+    SpaceVelocity velocity;
+    space_velocity(&velocity, ctx->screen_type, speed_modifier);
+    for(int i = pool->count - 1; i >= 0; i--) {
+        uint8_t id = pool->active[i];
+        pool->x[id] += velocity.dx;
+        pool->y[id] += velocity.dy;
+        pool->z[id] += velocity.dz;
+        if(pool->z[id] < 0) { // Flew past the ship
+            pool_kill(pool, id);
+            continue;
+        }
+        SpacePoint point = space_project(pool, id);
+        bool in_reach = point.x > 5 && point.x < PORTRAIT_WIDTH - 5 && point.y > 36 + 13 && point.y < 101 - 13;
+        if(pool->type[id] != SPACE_HAZARD) {
+            if(in_reach) {
+                if(pool->type[id] == SPACE_HEALTH) ctx->ship_health += 10; // Health pickup
+                else ctx->ship_armor += 5; // Armor pickup
+                pool_kill(pool, id);
+                continue;
             }
-        } else if(ctx->objects[i][2] < 0) { // Handle pickups
-            if(ctx->objects[i][0] > 5 && ctx->objects[i][0] < PORTRAIT_WIDTH - 5 &&
-               ctx->objects[i][1] > 36 + 13 && ctx->objects[i][1] < 101 - 13) {
-                if(ctx->objects[i][2] == -10) ctx->ship_health += 10; // Health pickup
-                else if(ctx->objects[i][2] == -5) ctx->ship_armor += 5; // Armor pickup
-                ctx->objects[i][2] = 0; // Remove pickup
+        } else if(point.size > PORTRAIT_WIDTH / 3 && point.size < PORTRAIT_WIDTH / 2 && in_reach) { // Close enough to hit
+            int damage = point.size * ctx->tuning.space_damage_pct / 100; // Damage based on size
+            if(ctx->screen_type != 0) damage /= 2; // Half damage if moving
+            if(abs(point.x - PORTRAIT_WIDTH / 2) < 5) damage *= 2; // Double damage if centered
+            if(ctx->ship_armor > 0) ctx->ship_armor -= damage;
+            else ctx->ship_health -= damage;
+            if(ctx->ship_health <= 0) {
+                ctx->ship_health = (game_rand(ctx) % 191) + 9; // Reset health
+                ctx->ship_armor = (game_rand(ctx) % 81) + 19; // Reset armor
+                ctx->screen_type = 8; // Dock sequence
+                ctx->last_sequence_time = furi_get_tick();
+                game_stats_fold(ctx); // Game over, the run goes on from the dock
             }
         }
+        if(point.y > 101 || point.y < 36) pool_kill(pool, id); // Off-screen
+    }
+    int cap = game_cap(ctx, WORLD_OBJ_LIMIT);
+    for(int i = pool->count; i < cap; i++) {
+        if(game_rand(ctx) % 100 >= ctx->tuning.space_spawn_pct) continue; // 10% spawn chance for each free place by default
+        uint8_t id = pool_spawn(pool, POOL_NO_LANE);
+        if(id == POOL_NONE) break;
+        pool->x[id] = ((int)(game_rand(ctx) % 32) - 16) * (1 << SPACE_WORLD_SHIFT); // Random x, spreads out as it nears
+        pool->y[id] = (game_rand(ctx) % 8 + 4) << SPACE_WORLD_SHIFT; // Below the line of sight
+        pool->z[id] = SPACE_Z_FAR;
+        pool->size[id] = (game_rand(ctx) % 10) + 5; // 5-14 pixel size at the spawn plane
+        // Comment: Adjust spawn chance or object size range for difficulty
+        if(ctx->ship_armor == 0 && game_rand(ctx) % 100 < 3) { // 3% health pickup
+            pool->type[id] = SPACE_HEALTH;
+            pool->size[id] = 10;
+        } else if(game_rand(ctx) % 100 < ctx->tuning.space_armor_pickup_pct) { // 25% armor pickup by default
+            pool->type[id] = SPACE_ARMOR;
+            pool->size[id] = 5;
+        }
     }
+}
+#endif // NAH_SPACE_FLIGHT
 
-    // Handle input sequences
-    if(furi_get_tick() - ctx->last_sequence_time > 1963) { // 1963ms cooldown
-        for(int i = 0; i < 4; i++) ctx->recent_inputs[i] = ctx->recent_inputs[i + 1];
-        ctx->recent_inputs[4] = -1; // Placeholder
-        if(ctx->is_holding[0]) ctx->recent_inputs[4] = 0; // Up
-        else if(ctx->is_holding[4]) ctx->recent_inputs[4] = 4; // Down
-        else if(ctx->is_holding[1]) ctx->recent_inputs[4] = 1; // Left
-        else if(ctx->is_holding[3]) ctx->recent_inputs[4] = 3; // Right
-        else if(ctx->is_holding[2]) ctx->recent_inputs[4] = 2; // OK
-        // Check sequences
-        if(ctx->recent_inputs[0] == 0 && ctx->recent_inputs[1] == 0 && ctx->recent_inputs[2] == 0 && ctx->recent_inputs[3] == 0 && ctx->recent_inputs[4] == 2) {
-            ctx->screen_type = 5; // Loop up
-            ctx->last_sequence_time = furi_get_tick();
-            furi_hal_vibro_on(true);
-            furi_delay_ms(32);
-            furi_hal_vibro_on(false);
-        } else if(ctx->recent_inputs[0] == 0 && ctx->recent_inputs[1] == 4 && ctx->recent_inputs[2] == 4 && ctx->recent_inputs[3] == 4 && ctx->recent_inputs[4] == 2) {
-            ctx->screen_type = 5; // Loop down
-            ctx->last_sequence_time = furi_get_tick();
-            furi_hal_vibro_on(true);
-            furi_delay_ms(32);
-            furi_hal_vibro_on(false);
-        } else if(ctx->recent_inputs[0] == 1 && ctx->recent_inputs[1] == 1 && ctx->recent_inputs[2] == 1 && ctx->recent_inputs[3] == 1 && ctx->recent_inputs[4] == 1) {
-            ctx->screen_type = 6; // Barrel roll left
-            ctx->last_sequence_time = furi_get_tick();
-            furi_hal_vibro_on(true);
-            furi_delay_ms(32);
-            furi_hal_vibro_on(false);
-        } else if(ctx->recent_inputs[0] == 3 && ctx->recent_inputs[1] == 3 && ctx->recent_inputs[2] == 3 && ctx->recent_inputs[3] == 3 && ctx->recent_inputs[4] == 3) {
-            ctx->screen_type = 6; // Barrel roll right
-            ctx->last_sequence_time = furi_get_tick();
-            furi_hal_vibro_on(true);
-            furi_delay_ms(32);
-            furi_hal_vibro_on(false);
-        }
-    }
-}
-
-// Input callback for handling all game inputs
-static void input_callback(InputEvent* input, void* ctx_ptr) {
-    GameContext* ctx = ctx_ptr;
-    if(!ctx) return;
+#if NAH_FLIP_ZIP || NAH_LINE_CAR || NAH_FLIP_IQ
+// Count a lane-change tap and check whether the tap rate is within 5 BPM of speed_bpm.
+// Cross-multiplied (tap_count * 60000 / window vs speed_bpm) so there is no divide or float.
+static bool lane_tap_matches_bpm(GameContext* ctx, uint32_t now) {
+    ctx->tap_count++;
+    if(now - ctx->tap_window_start >= 60000) {
+        ctx->tap_count = 1;
+        ctx->tap_window_start = now;
+    }
+    int32_t window = (int32_t)(now - ctx->tap_window_start + 1);
+    int32_t diff = ctx->tap_count * 60000 - ctx->speed_bpm * window;
+    return abs(diff) < 5 * window;
+}
+#endif // NAH_FLIP_ZIP || NAH_LINE_CAR || NAH_FLIP_IQ
+
+// Handle all game inputs
+static void input_handle(InputEvent* input, GameContext* ctx) {
     uint32_t now = furi_get_tick();
     if(now - ctx->last_input_time < TAP_DRM_MS) ctx->rapid_click_count++;
     else {
@@ -1285,24 +1654,27 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
     } else if(ctx->state == GAME_STATE_TITLE) {
         if(is_short && input->key == InputKeyLeft) {
             ctx->selected_side = 0;
-        } else if(is_short && input->key == InputKeyRight) {
+        } else if(is_short && input->key == InputKeyRight && ctx->selected_row * 2 + 1 < MENU_COUNT) {
             ctx->selected_side = 1;
         } else if(is_short && input->key == InputKeyUp && ctx->selected_row > 0) {
             ctx->selected_row--;
-        } else if(is_short && input->key == InputKeyDown && ctx->selected_row < 2) {
+        } else if(is_short && input->key == InputKeyDown && ctx->selected_row < MENU_ROWS - 1) {
             ctx->selected_row++;
+            if(ctx->selected_row * 2 + ctx->selected_side >= MENU_COUNT) ctx->selected_side = 0; // Odd game out
         } else if(is_short && input->key == InputKeyOk) {
-            ctx->selected_game = ctx->selected_row * 2 + ctx->selected_side;
+            ctx->selected_game = menu_entries[ctx->selected_row * 2 + ctx->selected_side].mode;
             ctx->state = GAME_STATE_ROTATE;
             ctx->rotate_start_time = now;
+            ctx->rotate_phase = 0;
             ctx->rotate_angle = 0;
-            ctx->zoom_factor = FIXED_POINT_SCALE;
+            ctx->zoom_factor = FX_ONE;
             ctx->rotate_skip = false;
         } else if(is_short && input->key == InputKeyBack && ctx->note_q_a == 0) {
             ctx->start_back_count++;
             if(ctx->start_back_count >= 3) {
                 ctx->state = GAME_STATE_CREDITS;
-                ctx->credits_y = SCREEN_HEIGHT + 10 * ((int)(sizeof(credits_lines) / sizeof(credits_lines[0])) - 1);
+                ctx->credits_y = CREDITS_START_Y;
+                ctx->credits_start_time = now;
                 ctx->start_back_count = 0;
             }
         } else if(is_press && input->key == InputKeyBack) {
@@ -1316,17 +1688,16 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
     } else if(ctx->state == GAME_STATE_ROTATE) {
         if(is_press) {
             ctx->rotate_skip = true;
-            ctx->state = ctx->selected_game == GAME_MODE_ZERO_HERO ? GAME_STATE_ZERO_HERO :
-                         ctx->selected_game == GAME_MODE_FLIP_ZIP ? GAME_STATE_FLIP_ZIP :
-                         ctx->selected_game == GAME_MODE_LINE_CAR ? GAME_STATE_LINE_CAR :
-                         ctx->selected_game == GAME_MODE_FLIP_IQ ? GAME_STATE_FLIP_IQ :
-                         ctx->selected_game == GAME_MODE_TECTONE_SIM ? GAME_STATE_TECTONE_SIM :
-                         ctx->selected_game == GAME_MODE_SPACE_FLIGHT ? GAME_STATE_SPACE_FLIGHT : GAME_STATE_ZERO_HERO;
+            ctx->state = GAME_MODE_STATE(ctx->selected_game);
             ctx->streak = 0; // Initialize streak to 0
             ctx->game_start_time = now;
             ctx->day_night_toggle_time = now + 300000;
             ctx->is_day = true;
+            game_arena_enter(ctx, ctx->selected_game);
+            game_stats_begin(ctx, ctx->selected_game);
+            pool_clear(&ctx->pool);
             // Initialize game-specific states
+            #if NAH_LINE_CAR
             if(ctx->state == GAME_STATE_LINE_CAR) {
                 ctx->car_lane = 2;
                 ctx->car_y = PORTRAIT_HEIGHT - 7;
@@ -1337,50 +1708,54 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
                 ctx->fast_line = 46; // 20 pixels below UI
                 ctx->slow_line = 101; // 20 pixels above marquee
                 ctx->prev_car_lane = ctx->car_lane;
-                for(int i = 0; i < 5; i++) {
-                    for(int j = 0; j < WORLD_OBJ_LIMIT; j++) {
-                        ctx->track_positions[i][j] = 0;
-                        int length = (rand() % 37) + 9; // 9-45 pixels
-                        if(j < (rand() % 6) + 3) { // 3-8 initial pieces
-                            ctx->track_pieces[i][j] = length;
-                            ctx->track_positions[i][j] = PORTRAIT_HEIGHT - length + (rand() % (PORTRAIT_HEIGHT - length));
-                        }
-                    }
-                }
-            } else if(ctx->state == GAME_STATE_FLIP_IQ) {
+                atomic_store(&ctx->lane_request, 0);
+                track_clear(&ctx->track, PORTRAIT_HEIGHT); // First segment under the car, the rest up to the top
+                line_car_extend(ctx);
+            }
+            #endif // NAH_LINE_CAR
+            #if NAH_FLIP_IQ
+            if(ctx->state == GAME_STATE_FLIP_IQ) {
                 ctx->car_lane = 2; // Initial lane
                 ctx->car_y = PORTRAIT_HEIGHT - 10; // Initial position
-                for(int i = 0; i < 5; i++) {
-                    for(int j = 0; j < WORLD_OBJ_LIMIT; j++) {
-                        ctx->key_columns[i][j] = 0;
-                        ctx->key_positions[i][j] = 0;
-                    }
-                }
-            } else if(ctx->state == GAME_STATE_TECTONE_SIM) {
-                ctx->anger = 5;
-                ctx->based = 7;
-                ctx->cuteness = 3;
-                ctx->sad = 4;
+                ctx->round_start_time = now;
+                ctx->ball_width = flip_iq_ball_width(ctx);
+                flip_iq_round_ball(ctx);
+                ctx->active_lanes = 5; // Start with all lanes
+                ctx->ball_count = ctx->ball_width * 6; // Max balls based on width
+                int miss_percent = game_rand(ctx) % 21; // 0-20% missed balls
+                ctx->ball_count -= (ctx->ball_count * miss_percent) / 100;
+                ctx->ball_count = ctx->ball_count > WORLD_OBJ_LIMIT ? WORLD_OBJ_LIMIT : ctx->ball_count; // Cap at global limit
+                // Comment: Adjust WORLD_OBJ_LIMIT or miss_percent for performance/difficulty tuning
+            }
+            #endif // NAH_FLIP_IQ
+            #if NAH_TECTONE_SIM
+            if(ctx->state == GAME_STATE_TECTONE_SIM) {
+                ctx->emotions[TECTONE_ANGER] = 5;
+                ctx->emotions[TECTONE_BASED] = 7;
+                ctx->emotions[TECTONE_CUTE] = 3;
+                ctx->emotions[TECTONE_SAD] = 4;
+                ctx->tectone_action = TECTONE_ACTION_NONE;
+                ctx->tectone_prop = -1;
+                ctx->comments = arena_alloc(&ctx->arena, WORLD_OBJ_LIMIT * sizeof(TectoneComment));
                 ctx->tectone_x = PORTRAIT_WIDTH / 2 - 3;
                 ctx->move_cooldown = 500; // Base cooldown
                 ctx->last_move_time = now;
-                for(int i = 0; i < WORLD_OBJ_LIMIT; i++) {
-                    ctx->comment_positions[i] = 0;
-                    ctx->comment_heights[i] = 0;
-                    ctx->hype_train[i] = false;
-                }
-            } else if(ctx->state == GAME_STATE_SPACE_FLIGHT) {
-                ctx->ship_health = (rand() % 191) + 9; // 9-199
-                ctx->ship_armor = (rand() % 81) + 19; // 19-99
+                ctx->hype_train = false;
+                ctx->last_comment_side = -1;
+                ctx->same_side_count = 0;
+            }
+            #endif // NAH_TECTONE_SIM
+            #if NAH_SPACE_FLIGHT
+            if(ctx->state == GAME_STATE_SPACE_FLIGHT) {
+                ctx->ship_health = (game_rand(ctx) % 191) + 9; // 9-199
+                ctx->ship_armor = (game_rand(ctx) % 81) + 19; // 19-99
                 ctx->screen_type = 0; // Forward
-                for(int i = 0; i < WORLD_OBJ_LIMIT; i++) {
-                    ctx->objects[i][0] = 0;
-                    ctx->objects[i][1] = 0;
-                    ctx->objects[i][2] = 0;
-                }
-                for(int i = 0; i < 5; i++) ctx->recent_inputs[i] = -1;
+                if(ctx->speed_bpm < BASE_BPM) ctx->speed_bpm = BASE_BPM; // Objects stand still at 0 BPM
+                ctx->combo_state = 0;
             }
+            #endif // NAH_SPACE_FLIGHT
         }
+    #if NAH_ZERO_HERO
     } else if(ctx->state == GAME_STATE_ZERO_HERO) {
         if(is_short && input->key == InputKeyBack) {
             ctx->state = GAME_STATE_PAUSE;
@@ -1394,6 +1769,8 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
             int key_idx = input->key == InputKeyUp ? 0 : input->key == InputKeyLeft ? 1 : input->key == InputKeyOk ? 2 : input->key == InputKeyRight ? 3 : input->key == InputKeyDown ? 4 : -1;
             if(key_idx >= 0) ctx->is_holding[key_idx] = is_press;
         }
+    #endif // NAH_ZERO_HERO
+    #if NAH_FLIP_ZIP
     } else if(ctx->state == GAME_STATE_FLIP_ZIP) {
         if(is_short && input->key == InputKeyBack) {
             ctx->state = GAME_STATE_PAUSE;
@@ -1406,28 +1783,16 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
         } else {
             if(is_short && input->key == InputKeyLeft && ctx->mascot_lane > 0) {
                 ctx->mascot_lane--;
-                ctx->tap_count++;
-                if(now - ctx->tap_window_start >= 60000) {
-                    ctx->tap_count = 1;
-                    ctx->tap_window_start = now;
-                }
-                float tap_bpm = (ctx->tap_count * 60000.0f) / (float)(now - ctx->tap_window_start + 1);
-                if(fabsf(tap_bpm - (float)ctx->speed_bpm) < 5.0f) {
+                if(lane_tap_matches_bpm(ctx, now)) {
                     ctx->speed_bpm += 10;
-                    if(ctx->speed_bpm > 120) ctx->speed_bpm = 120;
+                    if(ctx->speed_bpm > ctx->tuning.speed_max_bpm) ctx->speed_bpm = ctx->tuning.speed_max_bpm;
                 }
             }
             if(is_short && input->key == InputKeyRight && ctx->mascot_lane < 4) {
                 ctx->mascot_lane++;
-                ctx->tap_count++;
-                if(now - ctx->tap_window_start >= 60000) {
-                    ctx->tap_count = 1;
-                    ctx->tap_window_start = now;
-                }
-                float tap_bpm = (ctx->tap_count * 60000.0f) / (float)(now - ctx->tap_window_start + 1);
-                if(fabsf(tap_bpm - (float)ctx->speed_bpm) < 5.0f) {
+                if(lane_tap_matches_bpm(ctx, now)) {
                     ctx->speed_bpm += 10;
-                    if(ctx->speed_bpm > 120) ctx->speed_bpm = 120;
+                    if(ctx->speed_bpm > ctx->tuning.speed_max_bpm) ctx->speed_bpm = ctx->tuning.speed_max_bpm;
                 }
             }
             if(is_short && input->key == InputKeyUp && ctx->mascot_y < 20) {
@@ -1449,6 +1814,8 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
                 ctx->jump_hold_time = 0;
             }
         }
+    #endif // NAH_FLIP_ZIP
+    #if NAH_LINE_CAR
     } else if(ctx->state == GAME_STATE_LINE_CAR) {
         if(is_short && input->key == InputKeyBack) {
             ctx->state = GAME_STATE_PAUSE;
@@ -1462,59 +1829,17 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
             int key_idx = input->key == InputKeyUp ? 0 : input->key == InputKeyLeft ? 1 : input->key == InputKeyRight ? 3 : input->key == InputKeyDown ? 4 : -1;
             if(key_idx >= 0) ctx->is_holding[key_idx] = is_press;
             if(is_short && input->key == InputKeyLeft && ctx->car_lane > 0) {
-                ctx->prev_car_lane = ctx->car_lane;
-                ctx->car_lane--;
-                ctx->tap_count++;
-                if(now - ctx->tap_window_start >= 60000) {
-                    ctx->tap_count = 1;
-                    ctx->tap_window_start = now;
-                }
-                float tap_bpm = (ctx->tap_count * 60000.0f) / (float)(now - ctx->tap_window_start + 1);
-                if(fabsf(tap_bpm - (float)ctx->speed_bpm) < 5.0f) {
+                atomic_store(&ctx->lane_request, -1); // The update moves the car against the track
+                if(lane_tap_matches_bpm(ctx, now)) {
                     ctx->speed_bpm += 10;
-                    if(ctx->speed_bpm > 120) ctx->speed_bpm = 120;
-                }
-                if(ctx->is_holding[4]) { // Drifting with Down
-                    ctx->is_drifting = true;
-                    ctx->car_angle = -8; // Drift angle
-                    ctx->last_drift_time = now;
-                    ctx->drift_multiplier++;
-                } else {
-                    ctx->car_angle = -15; // Rotation angle
-                    if(ctx->track_positions[ctx->car_lane][0] > 0 && ctx->car_y >= ctx->track_positions[ctx->car_lane][0] - ctx->track_pieces[ctx->car_lane][0]) {
-                        ctx->uber_points++;
-                        snprintf(ctx->notification_text, sizeof(ctx->notification_text), line_car_notifications[0], ctx->uber_points);
-                        ctx->last_notification_time = furi_get_tick();
-                        ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
-                    }
+                    if(ctx->speed_bpm > ctx->tuning.speed_max_bpm) ctx->speed_bpm = ctx->tuning.speed_max_bpm;
                 }
             }
             if(is_short && input->key == InputKeyRight && ctx->car_lane < 4) {
-                ctx->prev_car_lane = ctx->car_lane;
-                ctx->car_lane++;
-                ctx->tap_count++;
-                if(now - ctx->tap_window_start >= 60000) {
-                    ctx->tap_count = 1;
-                    ctx->tap_window_start = now;
-                }
-                float tap_bpm = (ctx->tap_count * 60000.0f) / (float)(now - ctx->tap_window_start + 1);
-                if(fabsf(tap_bpm - (float)ctx->speed_bpm) < 5.0f) {
+                atomic_store(&ctx->lane_request, 1); // The update moves the car against the track
+                if(lane_tap_matches_bpm(ctx, now)) {
                     ctx->speed_bpm += 10;
-                    if(ctx->speed_bpm > 120) ctx->speed_bpm = 120;
-                }
-                if(ctx->is_holding[4]) { // Drifting with Down
-                    ctx->is_drifting = true;
-                    ctx->car_angle = 8; // Drift angle
-                    ctx->last_drift_time = now;
-                    ctx->drift_multiplier++;
-                } else {
-                    ctx->car_angle = 15; // Rotation angle
-                    if(ctx->track_positions[ctx->car_lane][0] > 0 && ctx->car_y >= ctx->track_positions[ctx->car_lane][0] - ctx->track_pieces[ctx->car_lane][0]) {
-                        ctx->uber_points++;
-                        snprintf(ctx->notification_text, sizeof(ctx->notification_text), line_car_notifications[0], ctx->uber_points);
-                        ctx->last_notification_time = furi_get_tick();
-                        ctx->notification_x = (PORTRAIT_WIDTH - strlen(ctx->notification_text) * 6) / 2;
-                    }
+                    if(ctx->speed_bpm > ctx->tuning.speed_max_bpm) ctx->speed_bpm = ctx->tuning.speed_max_bpm;
                 }
             }
             if(is_press && input->key == InputKeyUp) {
@@ -1531,6 +1856,8 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
                 ctx->speed_bpm -= (ctx->speed_bpm > MIN_SPEED_BPM) ? 1 : 0; // Brake slows speed
             }
         }
+    #endif // NAH_LINE_CAR
+    #if NAH_FLIP_IQ
     } else if(ctx->state == GAME_STATE_FLIP_IQ) {
         if(is_short && input->key == InputKeyBack) {
             ctx->state = GAME_STATE_PAUSE;
@@ -1545,31 +1872,19 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
             if(key_idx >= 0) ctx->is_holding[key_idx] = is_press;
             if(is_short && input->key == InputKeyLeft && ctx->car_lane > 0 && (ctx->car_lane - 1) < ctx->active_lanes) {
                 ctx->car_lane--;
-                ctx->tap_count++;
-                if(now - ctx->tap_window_start >= 60000) {
-                    ctx->tap_count = 1;
-                    ctx->tap_window_start = now;
-                }
-                float tap_bpm = (ctx->tap_count * 60000.0f) / (float)(now - ctx->tap_window_start + 1);
-                if(fabsf(tap_bpm - (float)ctx->speed_bpm) < 5.0f) {
+                if(lane_tap_matches_bpm(ctx, now)) {
                     ctx->speed_bpm += 10;
-                    if(ctx->speed_bpm > 120) ctx->speed_bpm = 120;
+                    if(ctx->speed_bpm > ctx->tuning.speed_max_bpm) ctx->speed_bpm = ctx->tuning.speed_max_bpm;
                 }
             }
             if(is_short && input->key == InputKeyRight && ctx->car_lane < 4 && (ctx->car_lane + 1) < ctx->active_lanes) {
                 ctx->car_lane++;
-                ctx->tap_count++;
-                if(now - ctx->tap_window_start >= 60000) {
-                    ctx->tap_count = 1;
-                    ctx->tap_window_start = now;
-                }
-                float tap_bpm = (ctx->tap_count * 60000.0f) / (float)(now - ctx->tap_window_start + 1);
-                if(fabsf(tap_bpm - (float)ctx->speed_bpm) < 5.0f) {
+                if(lane_tap_matches_bpm(ctx, now)) {
                     ctx->speed_bpm += 10;
-                    if(ctx->speed_bpm > 120) ctx->speed_bpm = 120;
+                    if(ctx->speed_bpm > ctx->tuning.speed_max_bpm) ctx->speed_bpm = ctx->tuning.speed_max_bpm;
                 }
             }
-            if(is_press && input->key == InputKeyUp && ctx->car_y > 46 + (5 - ctx->active_lanes) * 6) {
+            if(is_press && input->key == InputKeyUp && ctx->car_y > flip_iq_top(ctx)) {
                 ctx->is_holding[0] = true;
             } else if(is_release && input->key == InputKeyUp) {
                 ctx->is_holding[0] = false;
@@ -1578,6 +1893,8 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
                 ctx->car_y += 1;
             }
         }
+    #endif // NAH_FLIP_IQ
+    #if NAH_TECTONE_SIM
     } else if(ctx->state == GAME_STATE_TECTONE_SIM) {
         if(is_short && input->key == InputKeyBack) {
             ctx->state = GAME_STATE_PAUSE;
@@ -1602,6 +1919,8 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
                 else if(input->key == InputKeyOk) ctx->is_holding[2] = false;
             }
         }
+    #endif // NAH_TECTONE_SIM
+    #if NAH_SPACE_FLIGHT
     } else if(ctx->state == GAME_STATE_SPACE_FLIGHT) {
         if(is_short && input->key == InputKeyBack) {
             ctx->state = GAME_STATE_PAUSE;
@@ -1618,6 +1937,14 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
                 else if(input->key == InputKeyLeft) ctx->screen_type = 3; // Strife left
                 else if(input->key == InputKeyRight) ctx->screen_type = 4; // Strife right
                 else if(input->key == InputKeyOk) ctx->screen_type = 0; // Forward
+            }
+            if(is_press || input->type == InputTypeRepeat) { // Every press and hold repeat steps the combos
+                uint8_t maneuver = combo_feed(&ctx->combos, &ctx->combo_state, &ctx->combo_time, input->key, now);
+                if(maneuver != COMBO_NONE && now - ctx->last_sequence_time > ctx->tuning.space_combo_cooldown_ms) {
+                    ctx->screen_type = maneuver;
+                    ctx->last_sequence_time = now;
+                    ctx->combo_buzz = true;
+                }
             } else if(is_release) {
                 if(input->key == InputKeyUp || input->key == InputKeyDown || input->key == InputKeyLeft ||
                    input->key == InputKeyRight || input->key == InputKeyOk) {
@@ -1625,15 +1952,14 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
                 }
             }
         }
+    #endif // NAH_SPACE_FLIGHT
     } else if(ctx->state == GAME_STATE_PAUSE) {
         if(is_short && input->key == InputKeyOk) {
-            ctx->state = ctx->selected_game == GAME_MODE_ZERO_HERO ? GAME_STATE_ZERO_HERO :
-                         ctx->selected_game == GAME_MODE_FLIP_ZIP ? GAME_STATE_FLIP_ZIP :
-                         ctx->selected_game == GAME_MODE_LINE_CAR ? GAME_STATE_LINE_CAR :
-                         ctx->selected_game == GAME_MODE_FLIP_IQ ? GAME_STATE_FLIP_IQ :
-                         ctx->selected_game == GAME_MODE_TECTONE_SIM ? GAME_STATE_TECTONE_SIM :
-                         ctx->selected_game == GAME_MODE_SPACE_FLIGHT ? GAME_STATE_SPACE_FLIGHT : GAME_STATE_ZERO_HERO;
+            ctx->state = GAME_MODE_STATE(ctx->selected_game);
             ctx->pause_back_count = 0;
+        } else if(is_short && input->key == InputKeyUp) {
+            ctx->suspend = true; // Saved once the timer has stopped
+            ctx->should_exit = true;
         } else if(is_short && input->key == InputKeyBack) {
             ctx->pause_back_count++;
             if(ctx->pause_back_count >= 2) {
@@ -1655,232 +1981,477 @@ static void input_callback(InputEvent* input, void* ctx_ptr) {
     }
 }
 
-// Render callback for drawing all game states
+// OK held + Back toggles the perf overlay and SD trace, true if the event was used for it
+static bool perf_overlay_combo(Perf* perf, InputEvent* input) {
+    if(input->key == InputKeyOk) {
+        if(input->type == InputTypePress) perf->combo_ok_held = true;
+        if(input->type == InputTypeRelease) perf->combo_ok_held = false;
+        return false;
+    }
+    if(input->key != InputKeyBack) return false;
+    if(input->type == InputTypePress && perf->combo_ok_held) {
+        perf->overlay = !perf->overlay;
+        perf->combo_back_swallow = true;
+        return true;
+    }
+    if(perf->combo_back_swallow) {
+        if(input->type == InputTypeRelease) perf->combo_back_swallow = false;
+        return true;
+    }
+    return false;
+}
+
+// Input callback, timed as its own phase
+static void input_callback(InputEvent* input, void* ctx_ptr) {
+    GameContext* ctx = ctx_ptr;
+    if(!ctx) return;
+    uint32_t input_start = perf_clock();
+    if(!perf_overlay_combo(&ctx->perf, input)) {
+        input_handle(input, ctx);
+    }
+    perf_end(&ctx->perf, PERF_PHASE_INPUT, input_start);
+    if(ctx->perf.overlay) perf_stack_sample(&ctx->perf, PERF_STACK_INPUT, furi_thread_get_current_id());
+}
+
+#if NAH_FLIP_IQ
+// Flip IQ score to IQ: PP / (difficulty + 2) * 33.3, in tenths for display
+static int32_t flip_iq_tenths(int score, Difficulty difficulty) {
+    static const fx_t difficulty_recip[] = {FX_FRAC(1, 2), FX_FRAC(1, 3), FX_FRAC(1, 4)};
+    fx_t iq_per_pp = fx_mul(FX_FRAC(333, 10), difficulty_recip[difficulty]);
+    return (int32_t)(((int64_t)score * iq_per_pp * 10) >> FX_SHIFT);
+}
+#endif // NAH_FLIP_IQ
+
+// Update phase timed for a game state, PERF_PHASE_COUNT outside the games
+static PerfPhase perf_update_phase(GameState state) {
+    if(state < GAME_STATE_ZERO_HERO || state > GAME_STATE_SPACE_FLIGHT) return PERF_PHASE_COUNT;
+    return PERF_PHASE_ZERO_HERO + (state - GAME_STATE_ZERO_HERO);
+}
+
+// Microseconds in at most four characters, milliseconds past 999us
+static void perf_format_us(char* buffer, size_t size, uint32_t us) {
+    if(us < 1000) {
+        snprintf(buffer, size, "%lu", (unsigned long)us);
+    } else if(us < 10000) {
+        snprintf(buffer, size, "%lu.%lum", (unsigned long)(us / 1000), (unsigned long)(us / 100 % 10));
+    } else {
+        snprintf(buffer, size, "%lum", (unsigned long)(us / 1000));
+    }
+}
+
+// Avg and p99 per row, then the tick histogram, in the top left corner
+static void draw_perf_overlay(Canvas* canvas, const RenderSnapshot* snap) {
+    canvas_set_font(canvas, FontSecondary);
+    canvas_set_color(canvas, ColorBlack);
+    canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PERF_OVERLAY_ROWS * 8 + 36);
+    canvas_set_color(canvas, ColorWhite);
+    for(int i = 0; i < PERF_OVERLAY_ROWS; i++) {
+        perf_format_us(draw_scratch.avg, sizeof(draw_scratch.avg), snap->perf[i].avg_us);
+        perf_format_us(draw_scratch.p99, sizeof(draw_scratch.p99), snap->perf[i].p99_us);
+        snprintf(draw_scratch.text, sizeof(draw_scratch.text), "%s %s %s", perf_phase_names[snap->perf_phases[i]],
+                 draw_scratch.avg, draw_scratch.p99);
+        canvas_draw_str(canvas, 1, 7 + i * 8, draw_scratch.text);
+    }
+    uint16_t peak = 1;
+    for(int i = 0; i < PERF_BUCKETS; i++) {
+        if(snap->perf[0].histogram[i] > peak) peak = snap->perf[0].histogram[i];
+    }
+    int base_y = PERF_OVERLAY_ROWS * 8 + 10;
+    for(int i = 0; i < PERF_BUCKETS; i++) {
+        int height = (snap->perf[0].histogram[i] * 9 + peak - 1) / peak; // Any sample shows a pixel
+        if(height > 0) canvas_draw_box(canvas, 2 + i * 5, base_y - height + 1, 4, height);
+    }
+    snprintf(draw_scratch.text, sizeof(draw_scratch.text), "arena %u/%u", snap->arena_peak, MODE_ARENA_BYTES);
+    canvas_draw_str(canvas, 1, base_y + 8, draw_scratch.text);
+    snprintf(draw_scratch.text, sizeof(draw_scratch.text), "cap %u/%u", snap->capacity, CAPACITY_FULL);
+    canvas_draw_str(canvas, 1, base_y + 24, draw_scratch.text);
+    if(snap->stack_tightest < PERF_STACK_COUNT) { // Least free stack of any thread, ! under budget
+        snprintf(draw_scratch.text, sizeof(draw_scratch.text), "stack %s %u%s", perf_stack_names[snap->stack_tightest],
+                 snap->stack_free, snap->stack_free < PERF_STACK_BUDGET ? "!" : "");
+        canvas_draw_str(canvas, 1, base_y + 16, draw_scratch.text);
+    }
+}
+
+// Fill the back snapshot from the context and swap it in, runs on the timer thread
+static void render_publish(GameContext* ctx, uint32_t now) {
+    RenderSnapshot* snap = render_buffer_back(&ctx->render);
+    if(!snap) return; // GUI is still drawing the older one, catch up next tick
+    snap->state = ctx->state;
+    if(ctx->state == GAME_STATE_LOADING) {
+        snap->orientation = ViewPortOrientationHorizontal;
+    } else if(ctx->state == GAME_STATE_TITLE || ctx->state == GAME_STATE_CREDITS ||
+              (ctx->state == GAME_STATE_ROTATE && ctx->rotate_phase < 2)) {
+        snap->orientation = ctx->is_left_handed ? ViewPortOrientationHorizontalFlip : ViewPortOrientationHorizontal;
+    } else {
+        snap->orientation = ctx->is_left_handed ? ViewPortOrientationVerticalFlip : ViewPortOrientationVertical;
+    }
+    snap->is_day = ctx->is_day;
+    snap->intro_ms = now - ctx->game_start_time;
+    const Notification* notification = notify_front(&ctx->notify);
+    if(notification) {
+        snap->notification = *notification;
+        snap->notification_elapsed = notify_elapsed(notification, now);
+    } else {
+        snap->notification.text = NULL;
+    }
+    memcpy(snap->is_holding, ctx->is_holding, sizeof(snap->is_holding));
+    snap->hud = (RenderHud){ctx->streak, ctx->oflow, ctx->score, ctx->score_oflow};
+    snap->capacity = ctx->capacity;
+    #if NAH_SPACE_FLIGHT
+    if(ctx->state == GAME_STATE_SPACE_FLIGHT) {
+        space_publish(&ctx->pool, &snap->entities); // Projected, far to near
+    } else {
+        pool_publish(&ctx->pool, &snap->entities);
+    }
+    #else
+    pool_publish(&ctx->pool, &snap->entities);
+    #endif // NAH_SPACE_FLIGHT
+    snap->perf_overlay = ctx->perf.overlay;
+    if(snap->perf_overlay) {
+        snap->arena_peak = game_arena_peak(ctx);
+        snap->stack_tightest = perf_stack_tightest(&ctx->perf);
+        snap->stack_free = snap->stack_tightest < PERF_STACK_COUNT ? ctx->perf.stack_free[snap->stack_tightest] : 0;
+        PerfPhase update_phase = perf_update_phase(ctx->state);
+        snap->perf_phases[0] = PERF_PHASE_TICK;
+        snap->perf_phases[1] = update_phase != PERF_PHASE_COUNT ? update_phase : PERF_PHASE_ANIMATIONS;
+        snap->perf_phases[2] = PERF_PHASE_RENDER;
+        snap->perf_phases[3] = PERF_PHASE_INPUT;
+        for(int i = 0; i < PERF_OVERLAY_ROWS; i++) snap->perf[i] = ctx->perf.phases[snap->perf_phases[i]].report;
+    }
+
+    if(ctx->state == GAME_STATE_TITLE) {
+        snap->title.side = ctx->selected_side;
+        snap->title.row = ctx->selected_row;
+        snap->title.frame = ctx->title_frame;
+        snap->title.sweep = ctx->title_sweep;
+        for(int i = 0; i < 5; i++) snap->title.ball_y[i] = ctx->title_ball_y[i];
+        snap->title.ship_x = ctx->title_ship_x;
+        snap->title.ship_y = ctx->title_ship_y;
+    } else if(ctx->state == GAME_STATE_ROTATE) {
+        snap->rotate.phase = ctx->rotate_phase;
+        snap->rotate.zoom_factor = ctx->zoom_factor;
+        snap->rotate.angle = ctx->rotate_angle;
+    } else if(ctx->state == GAME_STATE_CREDITS) {
+        snap->credits.y = ctx->credits_y;
+    #if NAH_ZERO_HERO
+    } else if(ctx->state == GAME_STATE_ZERO_HERO) {
+        for(int i = 0; i < 5; i++) snap->zero_hero.strum_hit[i] = ctx->strum_hit[i];
+    #endif // NAH_ZERO_HERO
+    #if NAH_FLIP_ZIP
+    } else if(ctx->state == GAME_STATE_FLIP_ZIP) {
+        snap->flip_zip.lane = ctx->mascot_lane;
+        snap->flip_zip.mascot_y = PORTRAIT_HEIGHT - 7 - ctx->mascot_y - (ctx->is_jumping ? ctx->jump_height : 0);
+        snap->flip_zip.airborne = ctx->jump_scale > 0;
+        int speed_bpm = ctx->speed_bpm < MIN_SPEED_BPM ? MIN_SPEED_BPM : ctx->speed_bpm;
+        if(speed_bpm > ctx->tuning.speed_max_bpm) speed_bpm = ctx->tuning.speed_max_bpm;
+        snap->flip_zip.speed_bar_x = SPEED_BAR_X + ((speed_bpm - MIN_SPEED_BPM) * (SPEED_BAR_WIDTH - 1)) / (ctx->tuning.speed_max_bpm - MIN_SPEED_BPM); // Scale BPM to bar width
+    #endif // NAH_FLIP_ZIP
+    #if NAH_LINE_CAR
+    } else if(ctx->state == GAME_STATE_LINE_CAR) {
+        snap->line_car.lane = ctx->car_lane;
+        for(int i = 0; i < ctx->track.count; i++) {
+            const TrackSegment* segment = track_get(&ctx->track, i);
+            snap->entities.y[i] = segment->y;
+            snap->entities.size[i] = segment->length;
+            snap->entities.lane[i] = segment->lane;
+        }
+        snap->entities.count = ctx->track.count;
+        snap->line_car.car_y = ctx->car_y;
+        snap->line_car.car_angle = ctx->car_angle;
+        snap->line_car.wiggle = line_car_wiggles(ctx);
+        snap->line_car.wiggle_dx = snap->line_car.wiggle ? ctx->wiggle_dx : 0;
+    #endif // NAH_LINE_CAR
+    #if NAH_FLIP_IQ
+    } else if(ctx->state == GAME_STATE_FLIP_IQ) {
+        snap->flip_iq.active_lanes = ctx->active_lanes;
+        snap->flip_iq.lane = ctx->car_lane;
+        snap->flip_iq.car_y = ctx->car_y;
+        snap->flip_iq.show_timer = !snap->notification.text && ctx->game_start_time > 0;
+        snap->flip_iq.round_seconds = (now - ctx->round_start_time) / 1000;
+        snap->flip_iq.dead = flip_iq_dead(ctx);
+        snap->flip_iq.iq_tenths = flip_iq_tenths(ctx->score, ctx->difficulty);
+    #endif // NAH_FLIP_IQ
+    #if NAH_TECTONE_SIM
+    } else if(ctx->state == GAME_STATE_TECTONE_SIM) {
+        snap->tectone.x = ctx->tectone_x;
+        snap->tectone.blink = ctx->tectone_blink;
+        snap->tectone.paw = ctx->tectone_paw;
+        snap->tectone.prop = ctx->is_holding[4] ? ctx->tectone_prop : -1; // Down: Prop
+        for(int i = 0; i < ctx->pool.count && i < WORLD_OBJ_LIMIT; i++) {
+            snap->tectone.comments[i] = ctx->comments[ctx->pool.active[i]];
+        }
+    #endif // NAH_TECTONE_SIM
+    #if NAH_SPACE_FLIGHT
+    } else if(ctx->state == GAME_STATE_SPACE_FLIGHT) {
+        snap->space_flight.ship_health = ctx->ship_health;
+        snap->space_flight.ship_armor = ctx->ship_armor;
+        snap->space_flight.screen_type = ctx->screen_type;
+    #endif // NAH_SPACE_FLIGHT
+    }
+    render_buffer_publish(&ctx->render);
+    if(ctx->view_port) view_port_update(ctx->view_port);
+}
+
+// Render callback for drawing all game states, reads only the latest snapshot
 static void render_callback(Canvas* canvas, void* ctx_ptr) {
     GameContext* ctx = ctx_ptr;
     if(!ctx || !ctx->view_port || !canvas) return;
+    uint32_t draw_start = perf_clock();
+    const RenderSnapshot* snap = render_buffer_acquire(&ctx->render);
+    view_port_set_orientation(ctx->view_port, snap->orientation);
     canvas_clear(canvas);
-    if(ctx->state == GAME_STATE_LOADING) {
-        view_port_set_orientation(ctx->view_port, ViewPortOrientationHorizontal);
+    if(snap->state == GAME_STATE_LOADING) {
         draw_loading_screen(canvas);
-    } else if(ctx->state == GAME_STATE_TITLE) {
-        view_port_set_orientation(ctx->view_port, ctx->is_left_handed ? ViewPortOrientationHorizontalFlip : ViewPortOrientationHorizontal);
-        draw_title_menu(canvas, ctx);
-    } else if(ctx->state == GAME_STATE_ROTATE) {
-        draw_rotate_screen(canvas, ctx);
-    } else if(ctx->state == GAME_STATE_CREDITS) {
-        view_port_set_orientation(ctx->view_port, ctx->is_left_handed ? ViewPortOrientationHorizontalFlip : ViewPortOrientationHorizontal);
+    } else if(snap->state == GAME_STATE_TITLE) {
+        draw_title_menu(canvas, snap);
+    } else if(snap->state == GAME_STATE_ROTATE) {
+        draw_rotate_screen(canvas, snap);
+    } else if(snap->state == GAME_STATE_CREDITS) {
         canvas_set_color(canvas, ColorBlack);
         canvas_draw_box(canvas, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
         canvas_set_color(canvas, ColorWhite);
-        for(size_t i = 0; i < sizeof(credits_lines) / sizeof(credits_lines[0]); i++) {
-            int y = ctx->credits_y - i * 10;
+        for(int i = 0; i < CREDITS_LINE_COUNT; i++) {
+            int y = snap->credits.y - i * 10;
             if(y > -10 && y < SCREEN_HEIGHT) {
-                int text_width = strlen(credits_lines[i]) * 8;
-                int x = (SCREEN_WIDTH - text_width) / 2;
-                draw_word_wrapped_text(canvas, credits_lines[i], x, y, SCREEN_WIDTH - 20, FontPrimary);
+                int x = draw_center_x(canvas, credits_lines[i], SCREEN_WIDTH, FontPrimary);
+                draw_static_wrapped_text(canvas, credits_lines[i], x, y, SCREEN_WIDTH - x, FontPrimary);
             }
         }
-    } else if(ctx->state == GAME_STATE_PAUSE) {
-        view_port_set_orientation(ctx->view_port, ctx->is_left_handed ? ViewPortOrientationVerticalFlip : ViewPortOrientationVertical);
+    } else if(snap->state == GAME_STATE_PAUSE) {
         draw_pause_screen(canvas);
-    } else {
-        view_port_set_orientation(ctx->view_port, ctx->is_left_handed ? ViewPortOrientationVerticalFlip : ViewPortOrientationVertical);
-        if(ctx->state == GAME_STATE_ZERO_HERO) {
-            draw_zero_hero(canvas, ctx);
-        } else if(ctx->state == GAME_STATE_FLIP_ZIP) {
-            draw_flip_zip(canvas, ctx);
-        } else if(ctx->state == GAME_STATE_LINE_CAR) {
-            if(ctx->game_start_time == 0) {
-                ctx->game_start_time = furi_get_tick(); // Set start time for title screen
-            }
-            uint32_t elapsed = furi_get_tick() - ctx->game_start_time;
-            if(elapsed < 1300) {
-                draw_line_car_title(canvas, ctx);
-            } else {
-                draw_line_car(canvas, ctx);
-            }
-        } else if(ctx->state == GAME_STATE_FLIP_IQ) {
-            if(ctx->game_start_time == 0) {
-                ctx->game_start_time = furi_get_tick(); // Set start time for title screen
-            }
-            uint32_t elapsed = furi_get_tick() - ctx->game_start_time;
-            if(elapsed < 1300) {
-                draw_flip_iq_title(canvas, ctx);
-            } else {
-                // Draw background and game board
+    #if NAH_ZERO_HERO
+    } else if(snap->state == GAME_STATE_ZERO_HERO) {
+        draw_zero_hero(canvas, snap);
+    #endif // NAH_ZERO_HERO
+    #if NAH_FLIP_ZIP
+    } else if(snap->state == GAME_STATE_FLIP_ZIP) {
+        draw_flip_zip(canvas, snap);
+    #endif // NAH_FLIP_ZIP
+    #if NAH_LINE_CAR
+    } else if(snap->state == GAME_STATE_LINE_CAR) {
+        if(snap->intro_ms < GAME_TITLE_MS) {
+            draw_game_title(canvas, snap, "Line Car");
+        } else {
+            draw_line_car(canvas, snap);
+        }
+    #endif // NAH_LINE_CAR
+    #if NAH_FLIP_IQ
+    } else if(snap->state == GAME_STATE_FLIP_IQ) {
+        if(snap->intro_ms < GAME_TITLE_MS) {
+            draw_game_title(canvas, snap, "Flip IQ");
+        } else {
+            // Draw background and game board
+            canvas_set_color(canvas, ColorBlack);
+            canvas_draw_box(canvas, 0, 26, PORTRAIT_WIDTH, 20); // Background screen
+            canvas_set_color(canvas, ColorWhite);
+            canvas_draw_box(canvas, 0, 46, PORTRAIT_WIDTH, PORTRAIT_HEIGHT - 53); // Game board
+            // Draw inactive lanes
+            for(int i = snap->flip_iq.active_lanes; i < 5; i++) {
                 canvas_set_color(canvas, ColorBlack);
-                canvas_draw_box(canvas, 0, 26, PORTRAIT_WIDTH, 20); // Background screen
-                canvas_set_color(canvas, ColorWhite);
-                canvas_draw_box(canvas, 0, 46, PORTRAIT_WIDTH, PORTRAIT_HEIGHT - 53); // Game board
-                // Draw inactive lanes
-                for(int i = ctx->active_lanes; i < 5; i++) {
-                    canvas_set_color(canvas, ColorBlack);
-                    canvas_draw_box(canvas, i * 12, 46, 12, PORTRAIT_HEIGHT - 53);
-                }
-                // Draw balls with break effect
-                for(int i = 0; i < 5; i++) {
-                    for(int j = 0; j < WORLD_OBJ_LIMIT; j++) {
-                        if(ctx->key_positions[i][j] > 0 && ctx->key_positions[i][j] < PORTRAIT_HEIGHT - 7) {
-                            canvas_set_color(canvas, ColorWhite);
-                            canvas_draw_frame(canvas, i * 12 + 4, ctx->key_positions[i][j] - ctx->key_columns[i][j] / 2, ctx->key_columns[i][j], ctx->key_columns[i][j]);
-                            canvas_set_color(canvas, ColorBlack);
-                            if(ctx->ball_broken[j]) {
-                                canvas_draw_box(canvas, i * 12 + 4, ctx->key_positions[i][j], ctx->key_columns[i][j], ctx->key_columns[i][j] / 2); // Dither effect
-                            } else {
-                                canvas_draw_disc(canvas, i * 12 + 6, ctx->key_positions[i][j], ctx->key_columns[i][j] / 2);
-                            }
-                        }
-                    }
-                }
-                // Draw player
-                canvas_draw_box(canvas, ctx->car_lane * 12 + 4, ctx->car_y, 2, 3); // Body
-                canvas_draw_disc(canvas, ctx->car_lane * 12 + 5, ctx->car_y - 1, 1); // Head
-                canvas_draw_frame(canvas, ctx->car_lane * 12 + 3, ctx->car_y - 1, 4, 4); // Border
-                // Timer in marquee
-                if(ctx->notification_text[0] == '\0' && ctx->game_start_time > 0) {
-                    uint32_t elapsed = (furi_get_tick() - ctx->round_start_time) / 1000;
-                    uint32_t minutes = elapsed / 60;
-                    uint32_t seconds = elapsed % 60;
-                    char timer_str[12];
-                    snprintf(timer_str, sizeof(timer_str), "%02lu:%02lu", minutes, seconds);
-                    draw_word_wrapped_text(canvas, timer_str, (PORTRAIT_WIDTH - strlen(timer_str) * 6) / 2, PORTRAIT_HEIGHT - 1, PORTRAIT_WIDTH, FontSecondary);
-                }
-                // Death screen
-                if(ctx->car_y > 46 + (5 - ctx->active_lanes) * 6 && ctx->state != GAME_STATE_TITLE) {
-                    float gpa_to_iq = ((float)ctx->score / (float)(ctx->difficulty + 2) * 0.333f) * 100.0f;
-                    canvas_set_color(canvas, ColorBlack);
-                    canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PORTRAIT_HEIGHT);
+                canvas_draw_box(canvas, i * 12, 46, 12, PORTRAIT_HEIGHT - 53);
+            }
+            // Draw balls with break effect
+            const EntityList* balls = &snap->entities;
+            for(int i = 0; i < balls->count; i++) {
+                int x = balls->lane[i] * 12;
+                int position = balls->y[i];
+                int width = balls->size[i];
+                if(position > 0 && position < PORTRAIT_HEIGHT - 7) {
                     canvas_set_color(canvas, ColorWhite);
-                    draw_word_wrapped_text(canvas, "DEAD TOTAL", 10, 20, PORTRAIT_WIDTH - 20, FontPrimary);
-                    char score_str[32];
-                    snprintf(score_str, sizeof(score_str), "%d PP", ctx->score);
-                    draw_word_wrapped_text(canvas, score_str, 10, 30, PORTRAIT_WIDTH - 20, FontPrimary);
-                    draw_word_wrapped_text(canvas, "    ", 10, 40, PORTRAIT_WIDTH - 20, FontPrimary);
-                    draw_word_wrapped_text(canvas, "YOUR IQ IS:", 10, 50, PORTRAIT_WIDTH - 20, FontPrimary);
-                    char iq_str[32];
-                    snprintf(iq_str, sizeof(iq_str), "%.1f", (double)gpa_to_iq);
-                    draw_word_wrapped_text(canvas, iq_str, 10, 60, PORTRAIT_WIDTH - 20, FontPrimary);
-                    if(furi_get_tick() - ctx->last_notification_time > 1500) {
-                        ctx->score += ctx->score; // Add PP to total score
-                        ctx->state = GAME_STATE_TITLE;
+                    canvas_draw_frame(canvas, x + 4, position - width / 2, width, width);
+                    canvas_set_color(canvas, ColorBlack);
+                    if(balls->type[i] & BALL_BROKEN) {
+                        canvas_draw_box(canvas, x + 4, position, width, width / 2); // Dither effect
+                    } else {
+                        canvas_draw_disc(canvas, x + 6, position, width / 2);
                     }
                 }
             }
-        } else if(ctx->state == GAME_STATE_TECTONE_SIM) {
-            // Draw bedroom
-            canvas_set_color(canvas, ColorWhite);
-            canvas_draw_box(canvas, 0, 47, PORTRAIT_WIDTH, 21); // Wall
-            if(ctx->is_day) {
-                for(int i = 0; i < 4; i++) {
-                    canvas_draw_frame(canvas, 10 + i * 12, 50, 10, 10); // Window squares
-                }
-            } else {
-                canvas_draw_box(canvas, 10, 50, 48, 10); // Black window
+            // Draw player
+            int player_x = snap->flip_iq.lane * 12;
+            canvas_draw_box(canvas, player_x + 4, snap->flip_iq.car_y, 2, 3); // Body
+            canvas_draw_disc(canvas, player_x + 5, snap->flip_iq.car_y - 1, 1); // Head
+            canvas_draw_frame(canvas, player_x + 3, snap->flip_iq.car_y - 1, 4, 4); // Border
+            // Timer in marquee
+            if(snap->flip_iq.show_timer) {
+                char* text = draw_scratch.text;
+                snprintf(text, sizeof(draw_scratch.text), "%02d:%02d", (int)(snap->flip_iq.round_seconds / 60), (int)(snap->flip_iq.round_seconds % 60));
+                draw_word_wrapped_text(canvas, text, text_center(PORTRAIT_WIDTH, text_measure(canvas, FontSecondary, text)), PORTRAIT_HEIGHT - 1, PORTRAIT_WIDTH, FontSecondary);
             }
-            canvas_set_color(canvas, ColorBlack);
-            canvas_draw_box(canvas, 0, 53, PORTRAIT_WIDTH, 6); // Desk
-            canvas_draw_box(canvas, PORTRAIT_WIDTH - 12, 47, 12, 9); // Monitor
-            // Draw Tectone (bongo cat style)
-            canvas_set_color(canvas, ColorWhite);
-            canvas_draw_disc(canvas, ctx->tectone_x + 5, 50, 5); // Head
-            canvas_draw_line(canvas, ctx->tectone_x + 3, 55, ctx->tectone_x + 7, 55); // Mouth
-            canvas_draw_dot(canvas, ctx->tectone_x + 4, 49); // Left eye
-            canvas_draw_dot(canvas, ctx->tectone_x + 6, 49); // Right eye
-            int frame = (furi_get_tick() / 200) % 2;
-            if(frame == 0) {
-                canvas_draw_line(canvas, ctx->tectone_x + 4, 49, ctx->tectone_x + 6, 49); // Closed eyes
-            }
-            canvas_draw_disc(canvas, ctx->tectone_x + 2, 57, 2); // Left hand
-            canvas_draw_disc(canvas, ctx->tectone_x + 8, 57, 2); // Right hand
-            if((furi_get_tick() / 300) % 2 == 0) {
-                canvas_draw_box(canvas, ctx->tectone_x + 2, 57, 2, 2); // Left hand down
-                canvas_draw_disc(canvas, ctx->tectone_x + 8, 55, 2); // Right hand up
-            } else {
-                canvas_draw_disc(canvas, ctx->tectone_x + 2, 55, 2); // Left hand up
-                canvas_draw_box(canvas, ctx->tectone_x + 8, 57, 2, 2); // Right hand down
+            // Death screen, update_flip_iq returns to the title after it has shown
+            if(snap->flip_iq.dead) {
+                canvas_set_color(canvas, ColorBlack);
+                canvas_draw_box(canvas, 0, 0, PORTRAIT_WIDTH, PORTRAIT_HEIGHT);
+                canvas_set_color(canvas, ColorWhite);
+                draw_static_wrapped_text(canvas, "DEAD TOTAL", 10, 20, PORTRAIT_WIDTH - 20, FontPrimary);
+                char* text = draw_scratch.text;
+                snprintf(text, sizeof(draw_scratch.text), "%d PP", snap->hud.score);
+                draw_word_wrapped_text(canvas, text, 10, 30, PORTRAIT_WIDTH - 20, FontPrimary);
+                draw_static_wrapped_text(canvas, "    ", 10, 40, PORTRAIT_WIDTH - 20, FontPrimary);
+                draw_static_wrapped_text(canvas, "YOUR IQ IS:", 10, 50, PORTRAIT_WIDTH - 20, FontPrimary);
+                snprintf(text, sizeof(draw_scratch.text), "%d.%d", (int)(snap->flip_iq.iq_tenths / 10), (int)(snap->flip_iq.iq_tenths % 10));
+                draw_word_wrapped_text(canvas, text, 10, 60, PORTRAIT_WIDTH - 20, FontPrimary);
             }
-            // Draw props based on last action
-            if(ctx->is_holding[4]) { // Down: Prop
-                int prop = rand() % 3;
-                if(prop == 0) { // Microphone
-                    canvas_draw_str(canvas, ctx->tectone_x + 4, 52, "i");
-                } else if(prop == 1) { // Shotgun
-                    canvas_draw_str(canvas, ctx->tectone_x + 4, 52, "F");
-                    canvas_draw_str(canvas, ctx->tectone_x + 4, 50, "F");
-                } else { // Ball
-                    canvas_draw_disc(canvas, ctx->tectone_x + 5, 52, 2);
-                }
+        }
+    #endif // NAH_FLIP_IQ
+    #if NAH_TECTONE_SIM
+    } else if(snap->state == GAME_STATE_TECTONE_SIM) {
+        int tectone_x = snap->tectone.x;
+        // Draw bedroom
+        canvas_set_color(canvas, ColorWhite);
+        canvas_draw_box(canvas, 0, 47, PORTRAIT_WIDTH, 21); // Wall
+        if(snap->is_day) {
+            for(int i = 0; i < 4; i++) {
+                canvas_draw_frame(canvas, 10 + i * 12, 50, 10, 10); // Window squares
             }
-            // Draw button area
+        } else {
+            canvas_draw_box(canvas, 10, 50, 48, 10); // Black window
+        }
+        canvas_set_color(canvas, ColorBlack);
+        canvas_draw_box(canvas, 0, 53, PORTRAIT_WIDTH, 6); // Desk
+        canvas_draw_box(canvas, PORTRAIT_WIDTH - 12, 47, 12, 9); // Monitor
+        // Draw Tectone (bongo cat style)
+        canvas_set_color(canvas, ColorWhite);
+        canvas_draw_disc(canvas, tectone_x + 5, 50, 5); // Head
+        canvas_draw_line(canvas, tectone_x + 3, 55, tectone_x + 7, 55); // Mouth
+        canvas_draw_dot(canvas, tectone_x + 4, 49); // Left eye
+        canvas_draw_dot(canvas, tectone_x + 6, 49); // Right eye
+        if(snap->tectone.blink == 0) {
+            canvas_draw_line(canvas, tectone_x + 4, 49, tectone_x + 6, 49); // Closed eyes
+        }
+        canvas_draw_disc(canvas, tectone_x + 2, 57, 2); // Left hand
+        canvas_draw_disc(canvas, tectone_x + 8, 57, 2); // Right hand
+        if(snap->tectone.paw == 0) {
+            canvas_draw_box(canvas, tectone_x + 2, 57, 2, 2); // Left hand down
+            canvas_draw_disc(canvas, tectone_x + 8, 55, 2); // Right hand up
+        } else {
+            canvas_draw_disc(canvas, tectone_x + 2, 55, 2); // Left hand up
+            canvas_draw_box(canvas, tectone_x + 8, 57, 2, 2); // Right hand down
+        }
+        // Draw props based on last action
+        if(snap->tectone.prop == 0) { // Microphone
+            canvas_draw_str(canvas, tectone_x + 4, 52, "i");
+        } else if(snap->tectone.prop == 1) { // Shotgun
+            canvas_draw_str(canvas, tectone_x + 4, 52, "F");
+            canvas_draw_str(canvas, tectone_x + 4, 50, "F");
+        } else if(snap->tectone.prop == 2) { // Ball
+            canvas_draw_disc(canvas, tectone_x + 5, 52, 2);
+        }
+        // Draw button area
+        canvas_set_color(canvas, ColorWhite);
+        canvas_draw_box(canvas, 0, 68, PORTRAIT_WIDTH, 20);
+        canvas_set_color(canvas, ColorBlack);
+        draw_static_wrapped_text(canvas, "< : ANGER", 5, 70, 30, FontSecondary);
+        draw_static_wrapped_text(canvas, "\\/ : PROP", 40, 70, 30, FontSecondary);
+        draw_static_wrapped_text(canvas, "^ : BASED", 5, 80, 30, FontSecondary);
+        draw_static_wrapped_text(canvas, "> : UWU", 40, 80, 30, FontSecondary);
+        if(snap->is_holding[1]) canvas_draw_frame(canvas, 5, 70, 10, 10); // Anger button
+        if(snap->is_holding[4]) canvas_draw_frame(canvas, 40, 70, 10, 10); // Prop button
+        if(snap->is_holding[0]) canvas_draw_frame(canvas, 5, 80, 10, 10); // Based button
+        if(snap->is_holding[3]) canvas_draw_frame(canvas, 40, 80, 10, 10); // UWU button
+        // Draw comments
+        const EntityList* chat = &snap->entities;
+        for(int i = 0; i < chat->count && i < WORLD_OBJ_LIMIT; i++) {
+            const TectoneComment* comment = &snap->tectone.comments[i];
+            canvas_set_color(canvas, i % 2 ? ColorWhite : ColorBlack);
+            canvas_draw_frame(canvas, 0, chat->y[i], PORTRAIT_WIDTH, chat->size[i]);
+            canvas_set_color(canvas, i % 2 ? ColorBlack : ColorWhite);
+            const char* parts[] = {
+                tectone_starters[comment->words[0]],
+                tectone_subjects[comment->words[1]],
+                tectone_climaxes[comment->words[2]],
+                tectone_endpoints[comment->words[3]],
+            };
+            draw_wrapped_parts(canvas, parts, COUNT_OF(parts), 5, chat->y[i] + 2, PORTRAIT_WIDTH - 10, FontSecondary, &text_cache);
+        }
+        draw_notification(canvas, snap);
+    #endif // NAH_TECTONE_SIM
+    #if NAH_SPACE_FLIGHT
+    } else if(snap->state == GAME_STATE_SPACE_FLIGHT) {
+        if(snap->intro_ms < GAME_TITLE_MS) {
+            draw_game_title(canvas, snap, "Space Flight");
+        } else {
+            // Draw HUD
             canvas_set_color(canvas, ColorWhite);
-            canvas_draw_box(canvas, 0, 68, PORTRAIT_WIDTH, 20);
+            canvas_draw_box(canvas, 0, 26, PORTRAIT_WIDTH, 10);
+            char* text = draw_scratch.text;
+            snprintf(text, sizeof(draw_scratch.text), "[♥]: %d", snap->space_flight.ship_health);
+            draw_word_wrapped_text(canvas, text, 5, 32, 32, FontSecondary);
+            snprintf(text, sizeof(draw_scratch.text), "%d :[◯]", snap->space_flight.ship_armor);
+            draw_word_wrapped_text(canvas, text, 40, 32, 32, FontSecondary);
+            // Draw player view
             canvas_set_color(canvas, ColorBlack);
-            draw_word_wrapped_text(canvas, "< : ANGER", 5, 70, 30, FontSecondary);
-            draw_word_wrapped_text(canvas, "\\/ : PROP", 40, 70, 30, FontSecondary);
-            draw_word_wrapped_text(canvas, "^ : BASED", 5, 80, 30, FontSecondary);
-            draw_word_wrapped_text(canvas, "> : UWU", 40, 80, 30, FontSecondary);
-            if(ctx->is_holding[1]) canvas_draw_frame(canvas, 5, 70, 10, 10); // Anger button
-            if(ctx->is_holding[4]) canvas_draw_frame(canvas, 40, 70, 10, 10); // Prop button
-            if(ctx->is_holding[0]) canvas_draw_frame(canvas, 5, 80, 10, 10); // Based button
-            if(ctx->is_holding[3]) canvas_draw_frame(canvas, 40, 80, 10, 10); // UWU button
-            // Draw comments
-            for(int i = 0; i < WORLD_OBJ_LIMIT; i++) {
-                if(ctx->comment_positions[i] > 0) {
-                    canvas_set_color(canvas, i % 2 ? ColorWhite : ColorBlack);
-                    canvas_draw_frame(canvas, 0, ctx->comment_positions[i], PORTRAIT_WIDTH, ctx->comment_heights[i]);
-                    canvas_set_color(canvas, i % 2 ? ColorBlack : ColorWhite);
-                    char comment[32];
-                    snprintf(comment, sizeof(comment), "%s%s%s%s", tectone_starters[rand() % 4], tectone_subjects[rand() % 4], tectone_climaxes[rand() % 5], tectone_endpoints[rand() % 5]);
-                    draw_word_wrapped_text(canvas, comment, 5, ctx->comment_positions[i] + 2, PORTRAIT_WIDTH - 10, FontSecondary);
-                }
-            }
-            draw_notification(canvas, ctx);
-        } else if(ctx->state == GAME_STATE_SPACE_FLIGHT) {
-            if(ctx->game_start_time == 0) {
-                ctx->game_start_time = furi_get_tick(); // Set start time for title screen
-            }
-            uint32_t elapsed = furi_get_tick() - ctx->game_start_time;
-            if(elapsed < 1300) {
-                draw_space_flight_title(canvas, ctx);
-            } else {
-                // Draw HUD
-                canvas_set_color(canvas, ColorWhite);
-                canvas_draw_box(canvas, 0, 26, PORTRAIT_WIDTH, 10);
-                char health_str[16];
-                snprintf(health_str, sizeof(health_str), "[♥]: %d", ctx->ship_health);
-                draw_word_wrapped_text(canvas, health_str, 5, 32, 32, FontSecondary);
-                char armor_str[16];
-                snprintf(armor_str, sizeof(armor_str), "%d :[◯]", ctx->ship_armor);
-                draw_word_wrapped_text(canvas, armor_str, 40, 32, 32, FontSecondary);
-                // Draw player view
-                canvas_set_color(canvas, ColorBlack);
-                canvas_draw_box(canvas, 0, 36, PORTRAIT_WIDTH, 65); // Adjusted to 65 pixels
-                canvas_set_color(canvas, ColorWhite);
-                for(int i = 0; i < WORLD_OBJ_LIMIT; i++) {
-                    if(ctx->objects[i][2] > 0) {
-                        int size = ctx->objects[i][2] * (PORTRAIT_HEIGHT - ctx->objects[i][1]) / 100; // Scale based on distance
-                        canvas_draw_disc(canvas, ctx->objects[i][0], ctx->objects[i][1], size);
-                    } else if(ctx->objects[i][2] < 0) {
-                        canvas_draw_circle(canvas, ctx->objects[i][0], ctx->objects[i][1], abs(ctx->objects[i][2])); // Pickup
+            canvas_draw_box(canvas, 0, 36, PORTRAIT_WIDTH, 65); // Adjusted to 65 pixels
+            canvas_set_color(canvas, ColorWhite);
+            const EntityList* objects = &snap->entities;
+            for(int i = 0; i < objects->count; i++) {
+                if(objects->type[i] == SPACE_HAZARD) { // Already projected and sorted far to near
+                    if(snap->capacity < CAPACITY_FULL) {
+                        canvas_draw_circle(canvas, objects->x[i], objects->y[i], objects->size[i]); // Outlines while capped, fills cost more
+                    } else {
+                        canvas_draw_disc(canvas, objects->x[i], objects->y[i], objects->size[i]);
                     }
+                } else {
+                    canvas_draw_circle(canvas, objects->x[i], objects->y[i], objects->size[i]); // Pickup
                 }
-                // Draw user panel
-                canvas_set_color(canvas, ColorWhite);
-                canvas_draw_box(canvas, 0, 101, PORTRAIT_WIDTH, 10); // Adjusted to 10 pixels
-                canvas_set_color(canvas, ColorBlack);
-                if(ctx->screen_type == 5) canvas_draw_disc(canvas, 10, 105, 3); // Back loop light
-                if(ctx->screen_type == 6) canvas_draw_disc(canvas, 54, 105, 3); // Barrel roll light
-                canvas_draw_frame(canvas, 22, 102, 6, 6); // Up button
-                canvas_draw_frame(canvas, 30, 102, 6, 6); // Down button
-                canvas_draw_frame(canvas, 14, 102, 6, 6); // Left button
-                canvas_draw_frame(canvas, 38, 102, 6, 6); // Right button
-                if(ctx->is_holding[0]) canvas_draw_box(canvas, 22, 102, 6, 6);
-                if(ctx->is_holding[4]) canvas_draw_box(canvas, 30, 102, 6, 6);
-                if(ctx->is_holding[1]) canvas_draw_box(canvas, 14, 102, 6, 6);
-                if(ctx->is_holding[3]) canvas_draw_box(canvas, 38, 102, 6, 6);
-                draw_notification(canvas, ctx);
             }
+            // Draw user panel
+            canvas_set_color(canvas, ColorWhite);
+            canvas_draw_box(canvas, 0, 101, PORTRAIT_WIDTH, 10); // Adjusted to 10 pixels
+            canvas_set_color(canvas, ColorBlack);
+            if(snap->space_flight.screen_type == 5) canvas_draw_disc(canvas, 10, 105, 3); // Back loop light
+            if(snap->space_flight.screen_type == 6) canvas_draw_disc(canvas, 54, 105, 3); // Barrel roll light
+            canvas_draw_frame(canvas, 22, 102, 6, 6); // Up button
+            canvas_draw_frame(canvas, 30, 102, 6, 6); // Down button
+            canvas_draw_frame(canvas, 14, 102, 6, 6); // Left button
+            canvas_draw_frame(canvas, 38, 102, 6, 6); // Right button
+            if(snap->is_holding[0]) canvas_draw_box(canvas, 22, 102, 6, 6);
+            if(snap->is_holding[4]) canvas_draw_box(canvas, 30, 102, 6, 6);
+            if(snap->is_holding[1]) canvas_draw_box(canvas, 14, 102, 6, 6);
+            if(snap->is_holding[3]) canvas_draw_box(canvas, 38, 102, 6, 6);
+            draw_notification(canvas, snap);
+        }
+    #endif // NAH_SPACE_FLIGHT
+    }
+    if(snap->perf_overlay) draw_perf_overlay(canvas, snap);
+    render_buffer_release(&ctx->render);
+    perf_end(&ctx->perf, PERF_PHASE_RENDER, draw_start);
+    if(ctx->perf.overlay) perf_stack_sample(&ctx->perf, PERF_STACK_GUI, furi_thread_get_current_id());
+    #if NAH_BOT
+    bot_record_draw(&autoplay_bot, perf_elapsed_us(draw_start));
+    #endif // NAH_BOT
+}
+
+// Evaluate animation tracks once per tick so draw code only reads the results
+static void update_animations(GameContext* ctx, uint32_t now) {
+    if(ctx->state == GAME_STATE_TITLE) {
+        ctx->title_sweep = timeline_table_sample(&title_sweep_table, now);
+        for(int i = 0; i < 5; i++) {
+            ctx->title_ball_y[i] = timeline_table_sample(&title_sweep_table, now + i * 500);
+        }
+        ctx->title_ship_x = timeline_table_sample(&title_ship_x_table, now);
+        ctx->title_ship_y = timeline_table_sample(&title_ship_y_table, now);
+        ctx->title_frame = timeline_table_sample(&blink_table, now);
+    } else if(ctx->state == GAME_STATE_ROTATE) {
+        uint32_t elapsed = now - ctx->rotate_start_time;
+        if(elapsed < 1000) {
+            ctx->rotate_phase = 0;
+        } else if(elapsed < 1000 + ROTATE_ANIM_MS && !ctx->rotate_skip) {
+            ctx->rotate_phase = 1;
+            ctx->zoom_factor = timeline_track_eval(&rotate_zoom_track, elapsed - 1000);
+            ctx->rotate_angle = (fx_angle_t)timeline_track_eval(&rotate_angle_track, elapsed - 1000);
+        } else {
+            ctx->rotate_phase = 2;
+        }
+    #if NAH_TECTONE_SIM
+    } else if(ctx->state == GAME_STATE_TECTONE_SIM) {
+        ctx->tectone_blink = timeline_table_sample(&blink_table, now);
+        ctx->tectone_paw = timeline_table_sample(&paw_table, now);
+    #endif // NAH_TECTONE_SIM
+    } else if(ctx->state == GAME_STATE_CREDITS) {
+        ctx->credits_y = fx_to_int(timeline_track_eval(&credits_track, now - ctx->credits_start_time));
+        if(ctx->credits_y < -10) {
+            ctx->should_exit = true;
         }
     }
 }
@@ -1890,38 +2461,43 @@ static void timer_callback(void* ctx_ptr) {
     GameContext* ctx = ctx_ptr;
     if(!ctx) return;
     uint32_t now = furi_get_tick();
+    uint32_t tick_start = perf_clock();
+    arena_reset(&ctx->scratch);
+    #if NAH_BOT
+    bot_tick(&autoplay_bot, ctx, now, input_callback, ctx);
+    #endif // NAH_BOT
     ctx->frame_counter = (ctx->frame_counter + 1) % 3;
 
     // Faux multithreading: 3-frame cycle
     if(ctx->frame_counter == 0) {
         // Frame 1: Process input (handled in input_callback)
     } else if(ctx->frame_counter == 1) {
-        // Frame 2: Process notification text
-        if(ctx->notification_text[0] != '\0' && ctx->note_q_a == 0) {
-            uint32_t elapsed = now - ctx->last_notification_time;
-            if(elapsed < NOTIFICATION_MS) {
-                int text_width = strlen(ctx->notification_text) * 6;
-                ctx->notification_x = (PORTRAIT_WIDTH - text_width) / 2 - (elapsed * text_width / NOTIFICATION_MS);
-                if(ctx->notification_x < -text_width) ctx->notification_x += text_width;
-            } else {
-                ctx->notification_text[0] = '\0';
-                ctx->notification_x = 0;
-            }
-        }
+        // Frame 2: Advance the notification queue
+        notify_tick(&ctx->notify, now);
     } else if(ctx->frame_counter == 2) {
         // Frame 3: Process game updates
-        if(ctx->state == GAME_STATE_ZERO_HERO) {
-            update_zero_hero(ctx);
-        } else if(ctx->state == GAME_STATE_FLIP_ZIP) {
-            update_flip_zip(ctx);
-        } else if(ctx->state == GAME_STATE_LINE_CAR) {
-            update_line_car(ctx);
-        } else if(ctx->state == GAME_STATE_FLIP_IQ) {
-            update_flip_iq(ctx);
-        } else if(ctx->state == GAME_STATE_TECTONE_SIM) {
-            update_tectone_sim(ctx);
-        } else if(ctx->state == GAME_STATE_SPACE_FLIGHT) {
-            update_space_flight(ctx);
+        GameState updated = ctx->state;
+        uint32_t update_start = perf_clock();
+        #if NAH_ZERO_HERO
+        if(ctx->state == GAME_STATE_ZERO_HERO) update_zero_hero(ctx);
+        #endif // NAH_ZERO_HERO
+        #if NAH_FLIP_ZIP
+        if(ctx->state == GAME_STATE_FLIP_ZIP) update_flip_zip(ctx);
+        #endif // NAH_FLIP_ZIP
+        #if NAH_LINE_CAR
+        if(ctx->state == GAME_STATE_LINE_CAR) update_line_car(ctx);
+        #endif // NAH_LINE_CAR
+        #if NAH_FLIP_IQ
+        if(ctx->state == GAME_STATE_FLIP_IQ) update_flip_iq(ctx);
+        #endif // NAH_FLIP_IQ
+        #if NAH_TECTONE_SIM
+        if(ctx->state == GAME_STATE_TECTONE_SIM) update_tectone_sim(ctx);
+        #endif // NAH_TECTONE_SIM
+        #if NAH_SPACE_FLIGHT
+        if(ctx->state == GAME_STATE_SPACE_FLIGHT) update_space_flight(ctx);
+        #endif // NAH_SPACE_FLIGHT
+        if(perf_update_phase(updated) != PERF_PHASE_COUNT) {
+            perf_end(&ctx->perf, perf_update_phase(updated), update_start);
         }
     }
 
@@ -1930,32 +2506,68 @@ static void timer_callback(void* ctx_ptr) {
         ctx->is_day = !ctx->is_day;
         ctx->day_night_toggle_time = now + 300000;
     }
-    if(ctx->state == GAME_STATE_CREDITS) {
-        static uint32_t last_credits_update = 0;
-        if(now - last_credits_update >= 85) {
-            ctx->credits_y--;
-            last_credits_update = now;
-        }
-        if(ctx->credits_y < -10) {
-            ctx->should_exit = true;
-        }
-    }
+    haptic_tick(ctx, now);
+    game_stats_watch(ctx);
+    uint32_t phase_start = perf_clock();
+    update_animations(ctx, now);
+    perf_end(&ctx->perf, PERF_PHASE_ANIMATIONS, phase_start);
+    phase_start = perf_clock();
+    render_publish(ctx, now);
+    perf_end(&ctx->perf, PERF_PHASE_PUBLISH, phase_start);
+    perf_end(&ctx->perf, PERF_PHASE_TICK, tick_start);
+    game_capacity_update(ctx);
+    perf_trace_tick(&ctx->perf, now, ctx->state, ctx->capacity);
+    if(ctx->perf.overlay) perf_stack_sample(&ctx->perf, PERF_STACK_TIMER, furi_thread_get_current_id());
+    #if NAH_BOT
+    bot_record_tick(&autoplay_bot, perf_elapsed_us(tick_start));
+    bot_report_update(&autoplay_bot, ctx);
+    #endif // NAH_BOT
 }
 
-// Main application entry point
-int32_t nah2nah3_app(void* p) {
-    UNUSED(p);
-    // Allocate game context
-    GameContext* ctx = malloc(sizeof(GameContext));
-    if(!ctx) return -1;
+// Fresh context on the loading screen, shared with the host harness
+static void game_context_init(GameContext* ctx) {
     memset(ctx, 0, sizeof(GameContext));
+    render_buffer_init(&ctx->render);
+    perf_init(&ctx->perf);
     ctx->state = GAME_STATE_LOADING;
     ctx->game_start_time = furi_get_tick();
     ctx->is_day = true;
     ctx->day_night_toggle_time = furi_get_tick() + 300000;
     ctx->mascot_lane = 2;
     ctx->streak = 0; // Initialize streak to 0
-    srand(furi_get_tick());
+    ctx->last_comment_side = -1;
+    ctx->tuning = tuning_default;
+    ctx->arena_mode = GAME_MODE_COUNT;
+    ctx->capacity = CAPACITY_FULL;
+    pool_clear(&ctx->pool);
+    arena_init(&ctx->arena, ctx->arena_buffer, sizeof(ctx->arena_buffer));
+    #if NAH_SPACE_FLIGHT
+    combo_build(&ctx->combos, space_combos, COUNT_OF(space_combos));
+    #endif // NAH_SPACE_FLIGHT
+}
+
+// Leave the loading screen once LOADING_MS has passed
+static void update_loading(GameContext* ctx) {
+    if(ctx->state == GAME_STATE_LOADING && furi_get_tick() - ctx->game_start_time >= LOADING_MS) {
+        ctx->state = GAME_STATE_TITLE;
+        ctx->selected_side = 0;
+        ctx->selected_row = 0;
+        ctx->title_scroll_offset = 0;
+        view_port_input_callback_set(ctx->view_port, input_callback, ctx); // Re-register input
+    }
+}
+
+// Main application entry point
+int32_t nah2nah3_app(void* p) {
+    UNUSED(p);
+    // Allocate game context
+    GameContext* ctx = malloc(sizeof(GameContext));
+    if(!ctx) return -1;
+    game_context_init(ctx);
+    game_seed(ctx, furi_get_tick());
+    tuning_load(&ctx->tuning, &ctx->arena); // Before the timer starts, fps_base sets its period
+    stats_load(&ctx->stats);
+    bool resumed = game_resume(ctx, furi_get_tick()); // Straight to the paused game, no loading screen
 
     // Initialize GUI with extended delay for stability
     Gui* gui = furi_record_open(RECORD_GUI);
@@ -1973,13 +2585,26 @@ int32_t nah2nah3_app(void* p) {
     view_port_draw_callback_set(view_port, render_callback, ctx);
     view_port_input_callback_set(view_port, input_callback, ctx);
     view_port_set_orientation(view_port, ViewPortOrientationHorizontal);
-    furi_delay_ms(500); // Extended delay to stabilize GUI
+    if(!resumed) furi_delay_ms(500); // Extended delay to stabilize GUI
     gui_add_view_port(gui, view_port, GuiLayerFullscreen);
-    furi_delay_ms(100); // Additional delay post-add
+    if(!resumed) furi_delay_ms(100); // Additional delay post-add
 
-    // Speaker setup for SAM
+    animations_init();
+
+    #if NAH_BOT
+    BotConfig bot_config = {
+        .accuracy_pct = NAH_BOT_ACCURACY,
+        .latency_ms = NAH_BOT_LATENCY_MS,
+        .jitter_ms = NAH_BOT_JITTER_MS,
+        .seed = furi_get_tick(),
+    };
+    bot_init(&autoplay_bot, &bot_config);
+    uint32_t bot_last_log = furi_get_tick();
+    #endif // NAH_BOT
+
+    // SAM speaks from its own thread
     #if USE_SAM_TTS
-    sam_init(&voice);
+    tts_start(&speech);
     #endif // USE_SAM_TTS
 
     // Start timer
@@ -1990,7 +2615,7 @@ int32_t nah2nah3_app(void* p) {
         free(ctx);
         return -1;
     }
-    if(furi_timer_start(timer, 1000 / FPS_BASE) != FuriStatusOk) {
+    if(furi_timer_start(timer, 1000 / ctx->tuning.fps_base) != FuriStatusOk) {
         furi_timer_free(timer);
         view_port_free(view_port);
         furi_record_close(RECORD_GUI);
@@ -2000,21 +2625,36 @@ int32_t nah2nah3_app(void* p) {
 
     // Main loop with loading screen transition
     while(!ctx->should_exit) {
-        if(ctx->state == GAME_STATE_LOADING && furi_get_tick() - ctx->game_start_time >= LOADING_MS) {
-            ctx->state = GAME_STATE_TITLE;
-            ctx->selected_side = 0;
-            ctx->selected_row = 0;
-            ctx->title_scroll_offset = 0;
-            view_port_input_callback_set(ctx->view_port, input_callback, ctx); // Re-register input
+        update_loading(ctx);
+        perf_trace_flush(&ctx->perf);
+        stats_flush(&ctx->stats);
+        if(ctx->perf.overlay) {
+            perf_stack_sample(&ctx->perf, PERF_STACK_APP, furi_thread_get_current_id());
+            #if USE_SAM_TTS
+            perf_stack_sample(&ctx->perf, PERF_STACK_TTS, furi_thread_get_id(speech.thread));
+            #endif // USE_SAM_TTS
         }
+        #if NAH_BOT
+        if(furi_get_tick() - bot_last_log >= BOT_LOG_MS) {
+            bot_log_report(&autoplay_bot);
+            bot_last_log = furi_get_tick();
+        }
+        #endif // NAH_BOT
         furi_delay_ms(100);
     }
+    #if NAH_BOT
+    bot_log_report(&autoplay_bot);
+    #endif // NAH_BOT
 
     // Cleanup
     if(timer) {
         furi_timer_stop(timer);
         furi_timer_free(timer);
     }
+    #if USE_SAM_TTS
+    tts_stop(&speech);
+    #endif // USE_SAM_TTS
+    furi_hal_vibro_on(false); // In case a pattern was cut short
     if(view_port) {
         gui_remove_view_port(gui, view_port);
         view_port_draw_callback_set(view_port, NULL, NULL);
@@ -2025,6 +2665,11 @@ int32_t nah2nah3_app(void* p) {
         furi_record_close(RECORD_GUI);
     }
     if(ctx) {
+        ctx->perf.overlay = false; // Write out what is left of the trace
+        perf_trace_flush(&ctx->perf);
+        if(ctx->stats_playing) game_stats_fold(ctx);
+        stats_flush(&ctx->stats);
+        if(ctx->suspend) game_suspend(ctx, furi_get_tick());
         free(ctx);
     }
     return 0;
@@ -0,0 +1,416 @@
+#pragma once
+
+#include <furi.h>
+#include <gui/gui.h>
+#include <input/input.h>
+#include <stdatomic.h>
+#include "nah2nah3_arena.h"
+#include "nah2nah3_combo.h"
+#include "nah2nah3_fixed.h"
+#include "nah2nah3_notify.h"
+#include "nah2nah3_perf.h"
+#include "nah2nah3_pool.h"
+#include "nah2nah3_save.h"
+#include "nah2nah3_space.h"
+#include "nah2nah3_stats.h"
+#include "nah2nah3_text.h"
+#include "nah2nah3_track.h"
+#include "nah2nah3_tuning.h"
+
+// Games built into the fap. Set any to 0 (cdefines in application.fam) to drop
+// its code, tables, snapshot data and menu entry. Sizes per game are in host/Readme.md.
+#ifndef NAH_ZERO_HERO
+#define NAH_ZERO_HERO 1
+#endif
+#ifndef NAH_FLIP_ZIP
+#define NAH_FLIP_ZIP 1
+#endif
+#ifndef NAH_LINE_CAR
+#define NAH_LINE_CAR 1
+#endif
+#ifndef NAH_FLIP_IQ
+#define NAH_FLIP_IQ 1
+#endif
+#ifndef NAH_TECTONE_SIM
+#define NAH_TECTONE_SIM 1
+#endif
+#ifndef NAH_SPACE_FLIGHT
+#define NAH_SPACE_FLIGHT 1
+#endif
+#if !(NAH_ZERO_HERO || NAH_FLIP_ZIP || NAH_LINE_CAR || NAH_FLIP_IQ || NAH_TECTONE_SIM || NAH_SPACE_FLIGHT)
+#error "Build at least one game"
+#endif
+
+// Only Tectone Sim speaks
+#if !NAH_TECTONE_SIM
+#undef USE_SAM_TTS
+#define USE_SAM_TTS 0
+#endif
+
+// Constants for screen and game mechanics
+#define SCREEN_WIDTH 128
+#define SCREEN_HEIGHT 64
+#define PORTRAIT_WIDTH 64
+#define PORTRAIT_HEIGHT 128
+#define MAX_STREAK_INT 9999 // Arbitrary max for streak to handle overflow
+#define BACK_BUTTON_COOLDOWN 500 // 500ms cooldown for Back button
+#define ORIENTATION_HOLD_MS 1500 // 1.5s for orientation toggle
+#define CREDITS_FPS 11700 // 11.7 FPS = 85ms per frame
+#define CREDITS_STEP_MS 85 // Credits scroll one pixel per step
+#define LOADING_MS 1500 // 1.5s loading screen
+#define TAP_DRM_MS 300 // 0.3s for tap DRM
+#define MIN_SPEED_BPM 65 // Minimum speed for speed bar
+#define SPEED_BAR_Y (PORTRAIT_HEIGHT - 8)
+#define SPEED_BAR_HEIGHT 2
+#define SPEED_BAR_X 0
+#define SPEED_BAR_WIDTH PORTRAIT_WIDTH
+#define JUMP_STEP ((FX_ONE + 9) / 10) // Jump progress per tick, lands after 10 ticks
+#define JUMP_TICKS ((FX_ONE + JUMP_STEP - 1) / JUMP_STEP) // Updates from the press to landing
+#define JUMP_HEIGHT_PX 10 // Peak of the jump arc
+#define ROTATE_ANIM_MS 5000 // Rotate animation length after the 1s intro
+#define FLIP_ZIP_BASE_BPM 60 // Flip Zip scroll step grows every 60 BPM
+#define FLIP_ZIP_WALL_BPM 50 // One more obstacle per row every 50 BPM
+#define FLIP_ZIP_LANE_MS 250 // Lane change the row planner allows for, reaction included
+#define BASE_BPM 78 // Base speed for Line Car, Flip IQ and Space Flight
+#define TECTONE_BASE_BPM 58 // Base speed for Tectone Sim comment scroll
+#define SPEED_SCALE_MAX FX_FROM_INT(7) // 700% of base speed
+#define SPEED_SCALE_MIN FX_FRAC(66, 100) // 66% of base speed
+#define GAME_TITLE_MS 1300 // Title card before Line Car, Flip IQ and Space Flight
+#define SPACE_COMBO_STEP_MS 600 // Space Flight: longest gap between two keys of a maneuver, held keys repeat faster
+
+// Compiled object limits; spawns stay under the adaptive cap, a share of these
+#define WORLD_OBJ_LIMIT 8 // Per lane in Flip IQ, in all in Tectone Sim and Space Flight
+#define LANE_OBJ_LIMIT 10 // Notes or obstacles per lane in Zero Hero and Flip Zip
+#define CAPACITY_FULL 8 // Cap steps, full means the compiled limits
+#define CAPACITY_MIN 4 // Half the limits at worst
+#define CAPACITY_HIGH_PCT 60 // Step down when tick + draw p99 passes this share of the timer period...
+#define CAPACITY_LOW_PCT 30 // ...and back up once it is under this one
+#define MODE_ARENA_BYTES 1280 // Per-game data, reset when a game starts; fits a Tectone Sim suspend on top of its chat
+#define SCRATCH_ARENA_BYTES 128 // Carved from the mode arena, reset every tick
+
+// EntityPool type values
+#define BALL_BROKEN 0x01 // Flip IQ flags
+#define BALL_DROP 0x02 // Round ball, the round ends once it has fallen through
+#define FLIP_IQ_FALL_TICKS 8 // Updates a ball takes to reach its falling speed
+#define SPACE_HAZARD 0 // Space Flight kinds
+#define SPACE_HEALTH 1
+#define SPACE_ARMOR 2
+
+// Game states for the mini-game suite
+typedef enum {
+    GAME_STATE_LOADING, // Initial loading screen
+    GAME_STATE_TITLE,
+    GAME_STATE_ROTATE,
+    GAME_STATE_ZERO_HERO,
+    GAME_STATE_FLIP_ZIP,
+    GAME_STATE_LINE_CAR, // Racing simulator
+    GAME_STATE_FLIP_IQ,  // IQ-based game (replaces Drop Per)
+    GAME_STATE_TECTONE_SIM, // Streamer simulator
+    GAME_STATE_SPACE_FLIGHT, // Space flight game
+    GAME_STATE_CREDITS,
+    GAME_STATE_PAUSE
+} GameState;
+
+// Game modes for menu selection
+typedef enum {
+    GAME_MODE_ZERO_HERO,
+    GAME_MODE_FLIP_ZIP,
+    GAME_MODE_LINE_CAR,
+    GAME_MODE_FLIP_IQ,     // Replaces Drop Per
+    GAME_MODE_TECTONE_SIM,
+    GAME_MODE_SPACE_FLIGHT,
+    GAME_MODE_COUNT
+} GameMode;
+
+// Game states follow GameMode order
+#define GAME_MODE_STATE(mode) ((GameState)(GAME_STATE_ZERO_HERO + (mode)))
+
+// Tectone Sim emotions
+typedef enum {
+    TECTONE_ANGER,
+    TECTONE_BASED,
+    TECTONE_CUTE,
+    TECTONE_SAD,
+    TECTONE_EMOTION_COUNT
+} TectoneEmotion;
+
+#define TECTONE_EMOTION_MAX 9
+
+// Tectone Sim actions; the timed ones run until tectone_action_until
+typedef enum {
+    TECTONE_ACTION_NONE,
+    TECTONE_ACTION_SLAM_DESK,
+    TECTONE_ACTION_PUMP_GUN,
+    TECTONE_ACTION_BEEP, // Quiet for a while after
+    TECTONE_ACTION_GO_TO_BED, // Off screen, then asleep
+    TECTONE_ACTION_ASLEEP, // Off screen with the lights off
+    TECTONE_ACTION_EXIT_SCREEN,
+    TECTONE_ACTION_LIGHTS_OFF,
+    TECTONE_ACTION_HIDE_CHAT
+} TectoneAction;
+
+// Difficulty levels
+typedef enum {
+    DIFFICULTY_EASY,
+    DIFFICULTY_MEDIUM,
+    DIFFICULTY_HARD
+} Difficulty;
+
+// Suspend snapshot: SuspendHeader, then the running game's fields from
+// suspend_fields[] in table order. Bump the version when the table changes.
+#define SUSPEND_MAGIC 0x5553414EU // "NASU" little endian
+#define SUSPEND_VERSION 7
+
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t mode; // GameMode
+    uint16_t size; // Bytes after the header
+} SuspendHeader;
+
+// Tectone Sim chat comment, picked once when it spawns
+typedef struct {
+    uint8_t words[4]; // Starter, subject, climax, endpoint
+} TectoneComment;
+
+// Score line shared by the lane games
+typedef struct {
+    int streak;
+    int oflow;
+    int score;
+    int score_oflow;
+} RenderHud;
+
+// Everything the GUI thread needs for one frame, filled by the timer thread
+typedef struct {
+    GameState state;
+    ViewPortOrientation orientation;
+    bool is_day;
+    uint32_t intro_ms; // Time since the game started, for the title cards
+    Notification notification; // text is NULL when nothing is showing
+    uint16_t notification_elapsed; // Time at the front, scrolled once measured
+    bool is_holding[5];
+    RenderHud hud;
+    bool perf_overlay;
+    uint8_t perf_phases[PERF_OVERLAY_ROWS];
+    PerfReport perf[PERF_OVERLAY_ROWS];
+    uint16_t arena_peak; // Running game's arena high-water mark
+    uint8_t capacity; // Adaptive object cap, below CAPACITY_FULL the draw drops detail
+    uint8_t stack_tightest; // PerfStack with the least free stack, PERF_STACK_COUNT if unknown
+    uint16_t stack_free;
+    EntityList entities; // Live entities of the running game, see nah2nah3_pool.h; track segments in Line Car
+    union {
+        struct {
+            uint8_t side;
+            uint8_t row;
+            uint8_t frame;
+            int16_t sweep;
+            int16_t ball_y[5];
+            int16_t ship_x;
+            int16_t ship_y;
+        } title;
+        struct {
+            uint8_t phase;
+            fx_t zoom_factor;
+            fx_angle_t angle;
+        } rotate;
+        struct {
+            int16_t y;
+        } credits;
+        #if NAH_ZERO_HERO
+        struct {
+            bool strum_hit[5];
+        } zero_hero;
+        #endif // NAH_ZERO_HERO
+        #if NAH_FLIP_ZIP
+        struct {
+            int8_t lane;
+            int16_t mascot_y; // Screen row, jump included
+            bool airborne;
+            int16_t speed_bar_x;
+        } flip_zip;
+        #endif // NAH_FLIP_ZIP
+        #if NAH_LINE_CAR
+        struct {
+            int8_t lane;
+            int16_t car_y;
+            int8_t car_angle;
+            bool wiggle;
+            int8_t wiggle_dx;
+        } line_car;
+        #endif // NAH_LINE_CAR
+        #if NAH_FLIP_IQ
+        struct {
+            uint8_t active_lanes;
+            int8_t lane;
+            int16_t car_y;
+            bool show_timer;
+            uint32_t round_seconds;
+            bool dead;
+            int32_t iq_tenths;
+        } flip_iq;
+        #endif // NAH_FLIP_IQ
+        #if NAH_TECTONE_SIM
+        struct {
+            int16_t x;
+            uint8_t blink;
+            uint8_t paw;
+            int8_t prop; // -1 when no prop is out
+            TectoneComment comments[WORLD_OBJ_LIMIT]; // Of each entity, in entities order
+        } tectone;
+        #endif // NAH_TECTONE_SIM
+        #if NAH_SPACE_FLIGHT
+        struct {
+            int ship_health;
+            int ship_armor;
+            uint8_t screen_type;
+        } space_flight;
+        #endif // NAH_SPACE_FLIGHT
+    };
+} RenderSnapshot;
+
+// Two snapshots: the timer thread fills the back one and swaps the index
+typedef struct {
+    RenderSnapshot snapshots[2];
+    atomic_uchar front; // Latest complete snapshot
+    atomic_uchar reading; // Snapshot the GUI thread is drawing, RENDER_NONE when idle
+} RenderBuffer;
+
+// Game context structure to hold all game states and variables
+typedef struct {
+    GameState state;
+    GameMode selected_game;
+    bool is_left_handed;
+    uint32_t last_input_time;
+    uint8_t rapid_click_count;
+    uint32_t game_start_time;
+    bool is_day;
+    uint32_t day_night_toggle_time;
+    // Title menu
+    int selected_side; // 0: left, 1: right
+    int selected_row; // 0: row1, 1: row2, 2: row3
+    int title_scroll_offset; // For scrolling menu
+    uint32_t back_hold_start; // Track back button hold time
+    int title_sweep; // 0-29 slide for notes, car and mascot previews
+    int title_ball_y[5]; // Phase-shifted sweep for Flip IQ preview balls
+    int title_ship_x; // Space Flight preview drift
+    int title_ship_y; // Space Flight preview bob
+    uint8_t title_frame; // Two-frame Tectone preview
+    // Rotate animation
+    uint32_t rotate_start_time;
+    uint8_t rotate_phase; // 0: intro, 1: zoom, 2: rotate prompt
+    fx_angle_t rotate_angle; // Binary angle, 65536 per turn
+    fx_t zoom_factor; // Q16.16 scale
+    bool rotate_skip;
+    // Zero Hero
+    int streak;
+    int prev_streak;
+    int highest_streak;
+    int streak_sum;
+    int streak_count;
+    int oflow;
+    Difficulty difficulty;
+    uint32_t last_difficulty_check;
+    bool is_holding[5];
+    bool strum_hit[5]; // Highlight strumming bar on hit
+    int score;
+    int score_oflow;
+    NotifyQueue notify; // Scrolling line at the bottom, see nah2nah3_notify.h
+    uint8_t note_q_a; // 0: none, 1: YES, 2: NO
+    // Flip Zip
+    int mascot_lane; // 0 to 4
+    int mascot_y; // Vertical position in lanes plane
+    int speed_bpm;
+    uint32_t last_back_press;
+    bool is_jumping;
+    fx_t jump_progress; // Q16.16, 0 to FX_ONE over one jump
+    int jump_scale; // Grow/shrink during jump
+    int jump_height; // Pixels above the lane, follows a sine arc
+    uint32_t jump_hold_time; // Track OK button hold duration
+    int successful_jumps; // Count for speed increases
+    uint32_t last_tap_time; // For tap DRM and speed boost
+    int tap_count; // Track taps for BPM calculation
+    uint32_t tap_window_start; // Start of tap window for BPM
+    int jump_y_accumulated; // Track Up presses during jump
+    // Line Car
+    int car_lane; // Current lane (0-4)
+    int car_y; // Vertical position
+    int car_angle; // Rotation angle (0, 8, 15 degrees) - Simplified to offset instead of rotation
+    int prev_car_lane; // Track previous lane for drift comparison
+    int uber_points; // Skill points from drifting
+    int drift_multiplier; // Multiplier for successful drifts
+    uint32_t last_drift_time; // Timer for drift duration (tuning.drift_ms)
+    bool is_drifting; // Drift state
+    atomic_schar lane_request; // Lane step of a Left or Right tap, -1 or +1, taken by the update
+    int8_t wiggle_dx; // Car offset while a wide drift wiggles, rolled each update
+    int fast_line; // 20 pixels below UI (26 + 20 = 46)
+    int slow_line; // 20 pixels above marquee (128 - 7 - 20 = 101)
+    Track track; // Connected segments from the bottom of the screen up
+    // Flip IQ
+    int ball_width; // Width of initial drop ball
+    uint32_t round_start_time; // Timer for round duration
+    bool floor_check_flag; // Flag for floor removal
+    int active_lanes; // Number of active lanes (5 to 2)
+    int ball_count; // Total balls to drop per round
+    // Tectone Sim
+    uint8_t emotions[TECTONE_EMOTION_COUNT]; // Levels 0-9, indexed by TectoneEmotion
+    uint32_t emotion_cooldown; // Cooldown for emotion actions
+    TectoneAction tectone_action; // Timed action running, blocks further transitions
+    uint32_t tectone_action_until; // Tick the running action ends
+    int8_t tectone_prop; // Prop from the last Down press, -1 before the first
+    int tectone_x; // X position in bedroom
+    uint32_t move_cooldown; // Time between movements
+    uint32_t last_move_time; // Last movement time
+    TectoneComment* comments; // Text of each comment by entity id, in the mode arena
+    bool hype_train; // Hype train state
+    int last_comment_side; // Side of the previous comment, -1 before the first
+    int same_side_count; // Comments in a row on the same side
+    uint32_t hype_cooldown; // Hype train cooldown
+    uint8_t tectone_blink; // Eyes closed on frame 0
+    uint8_t tectone_paw; // Which paw is down
+    // Vibro pattern, stepped once per timer tick so nothing waits on it
+    uint8_t haptic_pulses; // Pulses still to play
+    bool haptic_on;
+    uint16_t haptic_on_ms;
+    uint16_t haptic_off_ms;
+    uint32_t haptic_next; // Tick of the next on/off edge
+    // Space Flight
+    int ship_health; // Player health (9-199)
+    int ship_armor; // Player armor (19-99)
+    int screen_type; // Current view type (forward, upward, etc.)
+    uint32_t last_sequence_time; // Cooldown for special sequences
+    ComboDfa combos; // Maneuver sequences, built once at init
+    uint8_t combo_state; // Progress through the sequences
+    uint32_t combo_time; // Tick of the last key fed to them
+    bool combo_buzz; // Set by input for a maneuver, buzzed from the timer
+    // Common
+    EntityPool pool; // Notes, obstacles, balls, comments and space objects
+    ViewPort* view_port;
+    bool should_exit;
+    bool suspend; // Save the paused game on the way out, it resumes on the next launch
+    uint32_t last_back_press_time;
+    uint32_t last_ai_update; // For faux-multithreading
+    uint8_t frame_counter; // For faux-multithreading
+    uint8_t start_back_count; // For title menu back count
+    uint8_t pause_back_count; // For pause menu back count
+    int credits_y; // For credits scrolling
+    uint32_t credits_start_time; // Credits timeline origin
+    uint8_t ai_beat_counter; // Added for AI-driven updates
+    uint32_t rng; // Per-context PRNG state, see game_rand()
+    GameTuning tuning;
+    RenderBuffer render;
+    Perf perf;
+    // Lifetime stats: folded at pause and game over, written by the app loop
+    Stats stats;
+    StatsRecord stats_base; // The running game's record when it started
+    bool stats_playing; // A game was running last tick
+    // Per-game memory: allocated when a game starts, then timer thread only
+    Arena arena;
+    Arena scratch; // Per-tick string building and temporaries
+    uint8_t arena_mode; // GameMode the arena belongs to, GAME_MODE_COUNT before the first
+    uint16_t arena_peak[GAME_MODE_COUNT]; // High-water mark of each game's earlier runs
+    uint32_t arena_buffer[MODE_ARENA_BYTES / sizeof(uint32_t)];
+    // Spawn cap and draw detail follow the measured tick and draw cost
+    uint8_t capacity; // CAPACITY_MIN..CAPACITY_FULL
+    uint16_t capacity_window; // Tick report the cap last looked at
+} GameContext;
@@ -0,0 +1,42 @@
+#include "nah2nah3_arena.h"
+
+#include <string.h>
+
+void arena_init(Arena* arena, void* buffer, size_t size) {
+    arena->base = buffer;
+    arena->size = size;
+    arena->used = 0;
+    arena->high_water = 0;
+    arena->failed = 0;
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+    size_t start = (arena->used + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    if(size > arena->size || start > arena->size - size) {
+        arena->failed++;
+        return NULL;
+    }
+    arena->used = start + size;
+    if(arena->used > arena->high_water) arena->high_water = arena->used;
+    void* block = arena->base + start;
+    memset(block, 0, size);
+    return block;
+}
+
+void arena_reset(Arena* arena) {
+    arena->used = 0;
+}
+
+size_t arena_mark(const Arena* arena) {
+    return arena->used;
+}
+
+void arena_rewind(Arena* arena, size_t mark) {
+    if(mark < arena->used) arena->used = mark;
+}
+
+bool arena_sub(Arena* parent, Arena* child, size_t size) {
+    void* buffer = arena_alloc(parent, size);
+    arena_init(child, buffer, buffer ? size : 0);
+    return buffer != NULL;
+}
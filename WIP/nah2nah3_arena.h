@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Fixed-size bump allocator over a caller-owned buffer. Nothing is freed on
+// its own: the owner resets the whole arena, or rewinds to a mark, once the
+// data is no longer used. Not thread safe, one thread allocates at a time.
+
+#define ARENA_ALIGN 4
+
+typedef struct {
+    uint8_t* base;
+    size_t size;
+    size_t used;
+    size_t high_water; // Most bytes in use since init
+    uint32_t failed; // Allocations that did not fit
+} Arena;
+
+void arena_init(Arena* arena, void* buffer, size_t size);
+
+// Zeroed block, NULL when the arena is full
+void* arena_alloc(Arena* arena, size_t size);
+
+// Drop everything, the high-water mark is kept
+void arena_reset(Arena* arena);
+
+// Rewind to an earlier arena_mark(), dropping what was allocated since
+size_t arena_mark(const Arena* arena);
+void arena_rewind(Arena* arena, size_t mark);
+
+// Carve a child arena out of the parent, for scratch reset on its own schedule
+bool arena_sub(Arena* parent, Arena* child, size_t size);
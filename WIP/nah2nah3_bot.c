@@ -0,0 +1,214 @@
+#include "nah2nah3_bot.h"
+
+#include <string.h>
+
+#define BOT_NOTE_LEAD 2 // Pixels before the hit window to commit to a note
+#define BOT_HOLD_MAX_MS 600 // Let go of a lane even if the note never arrived
+#define BOT_LONG_MS 300 // Presses shorter than this also send InputTypeShort
+#define BOT_DANGER_PX 30 // Flip Zip look-ahead above the mascot
+#define BOT_JUMP_HOLD_MS 200
+#define BOT_DECISION_GAP_MS 200
+#define BOT_SPACE_LOOKAHEAD 16 // Space Flight: pixels above the hit box to start strafing
+
+static const InputKey zero_hero_keys[BOT_LANES] = {
+    InputKeyUp, InputKeyLeft, InputKeyOk, InputKeyRight, InputKeyDown};
+
+static uint32_t bot_rand(Bot* bot) {
+    // xorshift32, kept separate from rand() so the bot never shifts the game's sequence
+    uint32_t x = bot->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    bot->rng = x;
+    return x;
+}
+
+static bool bot_roll(Bot* bot) {
+    return bot_rand(bot) % 100 < bot->config.accuracy_pct;
+}
+
+static uint32_t bot_delay(Bot* bot) {
+    uint32_t jitter = bot->config.jitter_ms ? bot_rand(bot) % (bot->config.jitter_ms + 1) : 0;
+    return bot->config.latency_ms + jitter;
+}
+
+static void bot_schedule(Bot* bot, uint32_t at, InputKey key, InputType type) {
+    if(bot->queue_count >= BOT_QUEUE_SIZE) return;
+    bot->queue[bot->queue_count++] = (BotEvent){at, key, type};
+}
+
+// Press now-ish, release later, with the Short event a real short press produces
+static void bot_schedule_tap(Bot* bot, uint32_t at, InputKey key, uint32_t hold_ms) {
+    bot_schedule(bot, at, key, InputTypePress);
+    if(hold_ms < BOT_LONG_MS) bot_schedule(bot, at + hold_ms, key, InputTypeShort);
+    bot_schedule(bot, at + hold_ms, key, InputTypeRelease);
+}
+
+static void bot_flush(Bot* bot, uint32_t now, BotInputCallback input, void* input_ctx) {
+    uint8_t kept = 0;
+    for(uint8_t i = 0; i < bot->queue_count; i++) {
+        BotEvent* event = &bot->queue[i];
+        if((int32_t)(now - event->at) >= 0) {
+            InputEvent input_event = {.sequence = ++bot->sequence, .key = event->key, .type = event->type};
+            input(&input_event, input_ctx);
+            bot->report.inputs++;
+        } else {
+            bot->queue[kept++] = *event;
+        }
+    }
+    bot->queue_count = kept;
+}
+
+static void bot_zero_hero(Bot* bot, const GameContext* ctx, uint32_t now) {
+    const EntityPool* pool = &ctx->pool;
+    for(int lane = 0; lane < BOT_LANES; lane++) {
+        int nearest = -1;
+        for(int i = 0; i < pool->count; i++) {
+            uint8_t id = pool->active[i];
+            int pos = pool->y[id];
+            if(pool->lane[id] == lane && pos <= PORTRAIT_HEIGHT - 4 && pos > nearest) nearest = pos;
+        }
+        bool approaching = nearest >= PORTRAIT_HEIGHT - 6 - BOT_NOTE_LEAD;
+
+        if(bot->lane_pressed[lane]) {
+            if((int32_t)(now - bot->lane_press_time[lane]) < 0) continue; // Press still in flight
+            if(!approaching || now - bot->lane_press_time[lane] > BOT_HOLD_MAX_MS) {
+                bool short_press = now - bot->lane_press_time[lane] < BOT_LONG_MS;
+                if(short_press) bot_schedule(bot, now, zero_hero_keys[lane], InputTypeShort);
+                bot_schedule(bot, now, zero_hero_keys[lane], InputTypeRelease);
+                bot->lane_pressed[lane] = false;
+            }
+            continue;
+        }
+        // Positions only grow, so a smaller one means the old note is gone
+        if(nearest < bot->lane_note[lane]) bot->lane_note[lane] = -1;
+        if(approaching && bot->lane_note[lane] < 0) {
+            bot->lane_note[lane] = nearest;
+            if(bot_roll(bot)) {
+                uint32_t at = now + bot_delay(bot);
+                bot_schedule(bot, at, zero_hero_keys[lane], InputTypePress);
+                bot->lane_pressed[lane] = true;
+                bot->lane_press_time[lane] = at;
+            }
+        }
+    }
+}
+
+static bool bot_lane_in_danger(const GameContext* ctx, int lane) {
+    if(lane < 0 || lane > 4) return true;
+    int mascot_y = PORTRAIT_HEIGHT - 7 - ctx->mascot_y;
+    const EntityPool* pool = &ctx->pool;
+    for(int i = 0; i < pool->count; i++) {
+        uint8_t id = pool->active[i];
+        int pos = pool->y[id];
+        if(pool->lane[id] == lane && pos >= mascot_y - BOT_DANGER_PX && pos <= mascot_y) return true;
+    }
+    return false;
+}
+
+static void bot_flip_zip(Bot* bot, const GameContext* ctx, uint32_t now) {
+    if((int32_t)(now - bot->next_decision_time) < 0) return;
+    if(ctx->is_jumping || !bot_lane_in_danger(ctx, ctx->mascot_lane)) return;
+    bot->next_decision_time = now + bot->config.latency_ms + BOT_DECISION_GAP_MS;
+    if(!bot_roll(bot)) return;
+
+    uint32_t at = now + bot_delay(bot);
+    bool left_free = !bot_lane_in_danger(ctx, ctx->mascot_lane - 1);
+    bool right_free = !bot_lane_in_danger(ctx, ctx->mascot_lane + 1);
+    if(left_free && right_free) {
+        bot_schedule_tap(bot, at, (bot_rand(bot) & 1) ? InputKeyLeft : InputKeyRight, 50);
+    } else if(left_free) {
+        bot_schedule_tap(bot, at, InputKeyLeft, 50);
+    } else if(right_free) {
+        bot_schedule_tap(bot, at, InputKeyRight, 50);
+    } else {
+        bot_schedule_tap(bot, at, InputKeyOk, BOT_JUMP_HOLD_MS);
+    }
+}
+
+// Hit box used by update_space_flight
+static bool bot_space_threat(const EntityPool* pool, uint8_t id) {
+    SpacePoint point = space_project(pool, id);
+    return pool->type[id] == SPACE_HAZARD && point.x > 5 && point.x < PORTRAIT_WIDTH - 5 &&
+           point.y > 36 + 13 - BOT_SPACE_LOOKAHEAD && point.y < 101 - 13;
+}
+
+static void bot_space_flight(Bot* bot, const GameContext* ctx, uint32_t now) {
+    const EntityPool* pool = &ctx->pool;
+    int threat = -1, threat_size = 0;
+    for(int i = 0; i < pool->count; i++) {
+        uint8_t id = pool->active[i];
+        int size = space_project(pool, id).size; // Nearest looks biggest
+        if(bot_space_threat(pool, id) && (threat < 0 || size > threat_size)) {
+            threat = id;
+            threat_size = size;
+        }
+    }
+    if(bot->strafe_held) {
+        if((int32_t)(now - bot->strafe_press_time) < 0) return; // Press still in flight
+        if(threat < 0) {
+            bot_schedule(bot, now, bot->strafe_key, InputTypeRelease);
+            bot->strafe_held = false;
+        }
+        return;
+    }
+    if(threat < 0 || (int32_t)(now - bot->next_decision_time) < 0) return;
+    bot->next_decision_time = now + bot->config.latency_ms + BOT_DECISION_GAP_MS;
+    if(!bot_roll(bot)) return;
+
+    // Strafing left pushes objects left, so push each one out the side of the line of sight it is on
+    bot->strafe_key = pool->x[threat] < 0 ? InputKeyLeft : InputKeyRight;
+    bot->strafe_press_time = now + bot_delay(bot);
+    bot->strafe_held = true;
+    bot_schedule(bot, bot->strafe_press_time, bot->strafe_key, InputTypePress);
+}
+
+void bot_init(Bot* bot, const BotConfig* config) {
+    memset(bot, 0, sizeof(Bot));
+    bot->config = *config;
+    bot->rng = config->seed ? config->seed : 0x9E3779B9U;
+    for(int lane = 0; lane < BOT_LANES; lane++) bot->lane_note[lane] = -1;
+}
+
+void bot_tick(Bot* bot, const GameContext* ctx, uint32_t now, BotInputCallback input, void* input_ctx) {
+    if(!bot || !ctx || !input) return;
+    if(ctx->state == GAME_STATE_ZERO_HERO) {
+        bot_zero_hero(bot, ctx, now);
+    } else if(ctx->state == GAME_STATE_FLIP_ZIP) {
+        bot_flip_zip(bot, ctx, now);
+    } else if(ctx->state == GAME_STATE_SPACE_FLIGHT) {
+        bot_space_flight(bot, ctx, now);
+    }
+    bot_flush(bot, now, input, input_ctx);
+}
+
+void bot_record_tick(Bot* bot, uint32_t us) {
+    bot->report.ticks++;
+    bot->report.total_tick_us += us;
+    if(us > bot->report.worst_tick_us) bot->report.worst_tick_us = us;
+}
+
+void bot_record_draw(Bot* bot, uint32_t us) {
+    bot->report.frames++;
+    bot->report.total_draw_us += us;
+    if(us > bot->report.worst_draw_us) bot->report.worst_draw_us = us;
+}
+
+void bot_report_update(Bot* bot, const GameContext* ctx) {
+    bot->report.score = ctx->score;
+    if(ctx->highest_streak > bot->report.max_streak) bot->report.max_streak = ctx->highest_streak;
+}
+
+void bot_log_report(const Bot* bot) {
+    const BotReport* report = &bot->report;
+    FURI_LOG_I(
+        "nah2nah3",
+        "bot: score %d streak %d inputs %lu tick %lu/%luus draw %lu/%luus",
+        report->score,
+        report->max_streak,
+        (unsigned long)report->inputs,
+        (unsigned long)(report->ticks ? report->total_tick_us / report->ticks : 0),
+        (unsigned long)report->worst_tick_us,
+        (unsigned long)(report->frames ? report->total_draw_us / report->frames : 0),
+        (unsigned long)report->worst_draw_us);
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "nah2nah3.h"
+
+// Autoplayer for Zero Hero, Flip Zip and Space Flight. It only reads the game context and
+// feeds InputEvents back through the regular input callback, so it exercises
+// the same code paths as a player on device or in the host harness.
+
+#define BOT_QUEUE_SIZE 16
+#define BOT_LANES 5
+#define BOT_LOG_MS 60000 // Device report interval
+
+// Device defaults, override with -D in the build flags
+#ifndef NAH_BOT_ACCURACY
+#define NAH_BOT_ACCURACY 90
+#endif
+#ifndef NAH_BOT_LATENCY_MS
+#define NAH_BOT_LATENCY_MS 120
+#endif
+#ifndef NAH_BOT_JITTER_MS
+#define NAH_BOT_JITTER_MS 60
+#endif
+
+typedef struct {
+    uint8_t accuracy_pct; // Chance of going for each note or obstacle
+    uint16_t latency_ms; // Reaction time before an input lands
+    uint16_t jitter_ms; // Random extra delay on top of latency
+    uint32_t seed;
+} BotConfig;
+
+typedef struct {
+    uint32_t ticks;
+    uint32_t frames;
+    uint32_t inputs;
+    uint32_t worst_tick_us;
+    uint32_t worst_draw_us;
+    uint64_t total_tick_us;
+    uint64_t total_draw_us;
+    int score;
+    int max_streak;
+} BotReport;
+
+typedef struct {
+    uint32_t at;
+    InputKey key;
+    InputType type;
+} BotEvent;
+
+typedef void (*BotInputCallback)(InputEvent* event, void* context);
+
+typedef struct {
+    BotConfig config;
+    uint32_t rng;
+    uint32_t sequence;
+    BotEvent queue[BOT_QUEUE_SIZE];
+    uint8_t queue_count;
+    int lane_note[BOT_LANES]; // Zero Hero: note position already decided on, -1 when idle
+    bool lane_pressed[BOT_LANES]; // Zero Hero: press sent and not yet released
+    uint32_t lane_press_time[BOT_LANES];
+    uint32_t next_decision_time; // Flip Zip/Space Flight: no new dodge before this tick
+    bool strafe_held; // Space Flight: strafe press sent and not yet released
+    InputKey strafe_key;
+    uint32_t strafe_press_time;
+    BotReport report;
+} Bot;
+
+void bot_init(Bot* bot, const BotConfig* config);
+
+// Decide and deliver due inputs for the current state; idle outside the three games
+void bot_tick(Bot* bot, const GameContext* ctx, uint32_t now, BotInputCallback input, void* input_ctx);
+
+// Tick/draw times from perf_elapsed_us()
+void bot_record_tick(Bot* bot, uint32_t us);
+void bot_record_draw(Bot* bot, uint32_t us);
+
+// Copy score and best streak from the context into the report
+void bot_report_update(Bot* bot, const GameContext* ctx);
+
+// Score, streak and timing summary to the furi log
+void bot_log_report(const Bot* bot);
@@ -0,0 +1,76 @@
+#include "nah2nah3_combo.h"
+
+#include <string.h>
+
+#define COMBO_EDGE_NONE 0xFF
+
+// Add a sequence to the trie, widening the window of each state it passes
+static bool combo_insert(ComboDfa* dfa, const ComboSequence* sequence) {
+    if(sequence->length == 0 || sequence->length > COMBO_LENGTH_MAX || sequence->result == COMBO_NONE) return false;
+    int state = 0;
+    for(int i = 0; i < sequence->length; i++) {
+        uint8_t key = sequence->keys[i];
+        if(key >= COMBO_KEYS) return false;
+        if(dfa->next[state][key] == COMBO_EDGE_NONE) {
+            if(dfa->count >= COMBO_STATES) return false;
+            dfa->next[state][key] = dfa->count++;
+        }
+        if(dfa->step_ms[state] < sequence->step_ms) dfa->step_ms[state] = sequence->step_ms;
+        state = dfa->next[state][key];
+    }
+    dfa->result[state] = sequence->result;
+    return true;
+}
+
+bool combo_build(ComboDfa* dfa, const ComboSequence* sequences, int count) {
+    memset(dfa->next, COMBO_EDGE_NONE, sizeof(dfa->next));
+    memset(dfa->result, COMBO_NONE, sizeof(dfa->result));
+    memset(dfa->step_ms, 0, sizeof(dfa->step_ms));
+    dfa->count = 1; // State 0 is the start
+    for(int i = 0; i < count; i++) {
+        if(!combo_insert(dfa, &sequences[i])) { // Every key leads back to the start
+            memset(dfa->next, 0, sizeof(dfa->next));
+            memset(dfa->result, COMBO_NONE, sizeof(dfa->result));
+            dfa->count = 1;
+            return false;
+        }
+    }
+
+    // Breadth first, missing edges follow the longest suffix that is also a prefix
+    uint8_t fallback[COMBO_STATES];
+    uint8_t queue[COMBO_STATES];
+    int head = 0, tail = 0;
+    for(int key = 0; key < COMBO_KEYS; key++) {
+        uint8_t child = dfa->next[0][key];
+        if(child == COMBO_EDGE_NONE) {
+            dfa->next[0][key] = 0;
+        } else {
+            fallback[child] = 0;
+            queue[tail++] = child;
+        }
+    }
+    while(head < tail) {
+        uint8_t state = queue[head++];
+        if(dfa->result[state] == COMBO_NONE) dfa->result[state] = dfa->result[fallback[state]];
+        for(int key = 0; key < COMBO_KEYS; key++) {
+            uint8_t child = dfa->next[state][key];
+            if(child == COMBO_EDGE_NONE) {
+                dfa->next[state][key] = dfa->next[fallback[state]][key];
+            } else {
+                fallback[child] = dfa->next[fallback[state]][key];
+                queue[tail++] = child;
+            }
+        }
+    }
+    return true;
+}
+
+uint8_t combo_feed(const ComboDfa* dfa, uint8_t* state, uint32_t* time, uint8_t key, uint32_t now) {
+    if(key >= COMBO_KEYS) return COMBO_NONE;
+    if(*state >= dfa->count || now - *time > dfa->step_ms[*state]) *state = 0; // Too slow, start over
+    *state = dfa->next[*state][key];
+    *time = now;
+    uint8_t result = dfa->result[*state];
+    if(result != COMBO_NONE) *state = 0; // The next combo starts fresh
+    return result;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Input combos as a small DFA. A table of key sequences is compiled once
+// into a transition table over the five game keys, with fallback edges so a
+// sequence that starts inside another still matches (Up Up Up Up Up Ok is a
+// loop). Each key press is then one table lookup, however many combos there
+// are. Every state has a timing window: a key arriving later than that after
+// the previous one starts over from the first key.
+
+#define COMBO_KEYS 5 // Up, Down, Right, Left and Ok, in InputKey order
+#define COMBO_LENGTH_MAX 8
+#define COMBO_STATES 32 // Enough for the sequences' keys together plus the start
+#define COMBO_NONE 0 // No combo finished
+
+typedef struct {
+    uint8_t keys[COMBO_LENGTH_MAX];
+    uint8_t length;
+    uint8_t result; // Returned when the last key lands, not COMBO_NONE
+    uint16_t step_ms; // Longest gap between two of its keys
+} ComboSequence;
+
+typedef struct {
+    uint8_t next[COMBO_STATES][COMBO_KEYS];
+    uint8_t result[COMBO_STATES];
+    uint16_t step_ms[COMBO_STATES]; // Window for the key after this state
+    uint8_t count;
+} ComboDfa;
+
+// Compile sequences, false if they need more than COMBO_STATES states or use
+// a key outside COMBO_KEYS; the DFA then never matches
+bool combo_build(ComboDfa* dfa, const ComboSequence* sequences, int count);
+
+// Step from *state on a key pressed at now, whose previous key came at *time.
+// Returns the finished combo's result, after which the next key starts over,
+// or COMBO_NONE.
+uint8_t combo_feed(const ComboDfa* dfa, uint8_t* state, uint32_t* time, uint8_t key, uint32_t now);
@@ -0,0 +1,41 @@
+#include "nah2nah3_fixed.h"
+
+// sin(i * 90deg / 64) in Q16.16, clamped to fit 16 bits at the peak
+static const uint16_t fx_sin_quarter[65] = {
+    0,     1608,  3216,  4821,  6424,  8022,  9616,  11204,
+    12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+    25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062,
+    36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+    46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581,
+    54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+    60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944,
+    64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516,
+    65535,
+};
+
+// Table lookup for one of 256 coarse steps per turn
+static fx_t fx_sin_step(uint8_t step) {
+    uint8_t i = step & 63;
+    switch(step >> 6) {
+    case 0:
+        return fx_sin_quarter[i];
+    case 1:
+        return fx_sin_quarter[64 - i];
+    case 2:
+        return -(fx_t)fx_sin_quarter[i];
+    default:
+        return -(fx_t)fx_sin_quarter[64 - i];
+    }
+}
+
+fx_t fx_sin(fx_angle_t angle) {
+    uint8_t step = angle >> 8;
+    fx_t frac = angle & 0xFF;
+    fx_t s0 = fx_sin_step(step);
+    fx_t s1 = fx_sin_step((uint8_t)(step + 1));
+    return s0 + (((s1 - s0) * frac) >> 8);
+}
+
+fx_t fx_cos(fx_angle_t angle) {
+    return fx_sin((fx_angle_t)(angle + 0x4000));
+}
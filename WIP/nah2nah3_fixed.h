@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stdint.h>
+
+// Q16.16 fixed-point math for the game loop. Everything on the hot path is an
+// add, a multiply or a shift; fx_div is kept for one-off setup math only.
+typedef int32_t fx_t;
+
+// Angles are binary: a full turn is 65536, so wrap-around is free on uint16_t.
+typedef uint16_t fx_angle_t;
+
+#define FX_SHIFT 16
+#define FX_ONE ((fx_t)1 << FX_SHIFT)
+#define FX_HALF (FX_ONE >> 1)
+#define FX_QUARTER (FX_ONE >> 2)
+
+// Compile-time constructors
+#define FX_FROM_INT(i) ((fx_t)((int32_t)(i) * FX_ONE))
+#define FX_FRAC(num, den) ((fx_t)(((int64_t)(num) << FX_SHIFT) / (den)))
+#define FX_DEG(d) ((fx_angle_t)(((uint32_t)(d) << 16) / 360))
+// 2^32 / den, used with fx_ratio() to divide an integer by a constant
+#define FX_RECIP32(den) ((uint32_t)(0xFFFFFFFFU / (uint32_t)(den)) + 1U)
+
+// Truncating conversion back to integer pixels/units (floor for negatives)
+static inline int32_t fx_to_int(fx_t a) {
+    return a >> FX_SHIFT;
+}
+
+static inline int32_t fx_round(fx_t a) {
+    return (a + FX_HALF) >> FX_SHIFT;
+}
+
+static inline fx_t fx_add(fx_t a, fx_t b) {
+    return a + b;
+}
+
+static inline fx_t fx_sub(fx_t a, fx_t b) {
+    return a - b;
+}
+
+static inline fx_t fx_mul(fx_t a, fx_t b) {
+    return (fx_t)(((int64_t)a * b) >> FX_SHIFT);
+}
+
+// Fixed-point times plain integer, result stays fixed-point
+static inline fx_t fx_mul_int(fx_t a, int32_t i) {
+    return a * i;
+}
+
+// Scale an integer by a fixed-point factor and return integer units
+static inline int32_t fx_scale(int32_t i, fx_t factor) {
+    return (int32_t)(((int64_t)i * factor) >> FX_SHIFT);
+}
+
+// Real divide; not for per-tick paths, prefer fx_ratio with a FX_RECIP32 constant
+static inline fx_t fx_div(fx_t a, fx_t b) {
+    if(b == 0) return a < 0 ? INT32_MIN : INT32_MAX;
+    return (fx_t)(((int64_t)a << FX_SHIFT) / b);
+}
+
+// num / den as fixed-point, with recip32 = FX_RECIP32(den) precomputed
+static inline fx_t fx_ratio(int32_t num, uint32_t recip32) {
+    return (fx_t)(((int64_t)num * recip32) >> FX_SHIFT);
+}
+
+static inline fx_t fx_clamp(fx_t a, fx_t lo, fx_t hi) {
+    return a < lo ? lo : a > hi ? hi : a;
+}
+
+// a + (b - a) * t, t in [0, FX_ONE]
+static inline fx_t fx_lerp(fx_t a, fx_t b, fx_t t) {
+    return a + fx_mul(b - a, t);
+}
+
+// Sine and cosine from a quarter-wave table with linear interpolation
+fx_t fx_sin(fx_angle_t angle);
+fx_t fx_cos(fx_angle_t angle);
@@ -0,0 +1,90 @@
+#include "nah2nah3_notify.h"
+
+#include <string.h>
+
+void notify_clear(NotifyQueue* queue) {
+    queue->count = 0;
+}
+
+static void notify_remove(NotifyQueue* queue, uint8_t index) {
+    queue->count--;
+    memmove(&queue->entries[index], &queue->entries[index + 1], (queue->count - index) * sizeof(Notification));
+}
+
+static void notify_show(Notification* notification, uint32_t now) {
+    notification->start = now ? now : 1; // 0 marks a waiting entry
+    notification->deadline = now + NOTIFY_SHOW_MS;
+}
+
+static void notify_insert(NotifyQueue* queue, const Notification* entry, uint32_t now) {
+    if(queue->count && entry->priority > queue->entries[0].priority) notify_remove(queue, 0); // Cut off the lower line
+    if(queue->count == NOTIFY_QUEUE_SIZE) {
+        if(entry->priority < queue->entries[queue->count - 1].priority) return;
+        queue->count--;
+    }
+    // Behind the same or higher priority, never ahead of the line showing
+    uint8_t index = queue->count;
+    while(index > 0 && queue->entries[index - 1].start == 0 && queue->entries[index - 1].priority < entry->priority) {
+        index--;
+    }
+    memmove(&queue->entries[index + 1], &queue->entries[index], (queue->count - index) * sizeof(Notification));
+    queue->entries[index] = *entry;
+    queue->count++;
+    if(queue->entries[0].start == 0) notify_show(&queue->entries[0], now);
+}
+
+void notify_push(NotifyQueue* queue, const char* text, NotifyPriority priority, uint32_t now) {
+    // A line already waiting is not queued twice
+    for(uint8_t i = 1; i < queue->count; i++) {
+        if(queue->entries[i].text == text) return;
+    }
+    Notification entry = {
+        .text = text,
+        .priority = priority,
+        .deadline = now + NOTIFY_WAIT_MS,
+    };
+    notify_insert(queue, &entry, now);
+}
+
+void notify_push_value(NotifyQueue* queue, const char* format, int16_t value, NotifyPriority priority, uint32_t now) {
+    // Repeats of a waiting counter line only update its value
+    for(uint8_t i = 1; i < queue->count; i++) {
+        if(queue->entries[i].text == format) {
+            queue->entries[i].value = value;
+            return;
+        }
+    }
+    Notification entry = {
+        .text = format,
+        .value = value,
+        .formatted = true,
+        .priority = priority,
+        .deadline = now + NOTIFY_WAIT_MS,
+    };
+    notify_insert(queue, &entry, now);
+}
+
+void notify_tick(NotifyQueue* queue, uint32_t now) {
+    while(queue->count && (int32_t)(now - queue->entries[0].deadline) >= 0) {
+        notify_remove(queue, 0);
+        if(queue->count && queue->entries[0].start == 0) {
+            if((int32_t)(now - queue->entries[0].deadline) >= 0) continue; // Waited too long
+            notify_show(&queue->entries[0], now);
+        }
+    }
+}
+
+const Notification* notify_front(const NotifyQueue* queue) {
+    return queue->count && queue->entries[0].start ? &queue->entries[0] : NULL;
+}
+
+uint16_t notify_elapsed(const Notification* notification, uint32_t now) {
+    uint32_t elapsed = now - notification->start;
+    return elapsed > NOTIFY_SHOW_MS ? NOTIFY_SHOW_MS : elapsed;
+}
+
+int16_t notify_x(uint16_t width, uint16_t elapsed) {
+    int x = (NOTIFY_LINE_WIDTH - (int)width) / 2 - (int)((uint32_t)elapsed * width / NOTIFY_SHOW_MS);
+    if(x < -(int)width) x += width;
+    return x;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Scrolling notification line as a short priority queue. Entries point at
+// static strings (or a printf format plus one value), so nothing is copied.
+// The GUI thread measures the line and turns its time at the front into a scroll.
+
+#define NOTIFY_QUEUE_SIZE 4
+#define NOTIFY_SHOW_MS 1500 // Time at the front, scrolling one text width
+#define NOTIFY_WAIT_MS 3000 // Dropped unshown after waiting this long
+#define NOTIFY_LINE_WIDTH 64 // Portrait screen width
+
+typedef enum {
+    NOTIFY_LOW, // Cheers and flavor text, dropped first
+    NOTIFY_NORMAL, // Misses, points and actions
+    NOTIFY_HIGH, // Milestones and round ends, never cut off by lower ones
+} NotifyPriority;
+
+typedef struct {
+    const char* text; // Static string, or a format taking value when formatted
+    int16_t value;
+    bool formatted;
+    uint8_t priority; // NotifyPriority
+    uint32_t start; // Tick it reached the front, 0 while waiting
+    uint32_t deadline; // Dropped at this tick
+} Notification;
+
+typedef struct {
+    Notification entries[NOTIFY_QUEUE_SIZE]; // Front first, then by priority, oldest first
+    uint8_t count;
+} NotifyQueue;
+
+void notify_clear(NotifyQueue* queue);
+
+// Queue a line. A higher priority one replaces the line showing; a full queue
+// drops its newest lowest-priority entry, or the new one if that ranks lower.
+void notify_push(NotifyQueue* queue, const char* text, NotifyPriority priority, uint32_t now);
+void notify_push_value(NotifyQueue* queue, const char* format, int16_t value, NotifyPriority priority, uint32_t now);
+
+// Once per tick: retire the front when its time is up and start the next one
+void notify_tick(NotifyQueue* queue, uint32_t now);
+
+// Line showing now, NULL if none
+const Notification* notify_front(const NotifyQueue* queue);
+
+// Time the front line has been showing, capped at NOTIFY_SHOW_MS
+uint16_t notify_elapsed(const Notification* notification, uint32_t now);
+
+// Left edge of a line width pixels wide: centred, then scrolling left one width over NOTIFY_SHOW_MS
+int16_t notify_x(uint16_t width, uint16_t elapsed);
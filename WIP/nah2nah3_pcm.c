@@ -0,0 +1,142 @@
+#include "nah2nah3_pcm.h"
+#include "nah2nah3_perf.h"
+
+#include <furi.h>
+#include <furi_hal_speaker.h>
+#include <stdlib.h>
+#include <string.h>
+#include <storage/storage.h>
+
+static const int16_t pcm_step_table[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+    31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+    544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+    9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+static const int8_t pcm_index_table[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+// Apply one nibble to the decoder state, shared by both directions
+static void pcm_adpcm_step(PcmState* state, uint8_t nibble) {
+    int32_t step = pcm_step_table[state->step_index];
+    int32_t diff = step >> 3;
+    if(nibble & 4) diff += step;
+    if(nibble & 2) diff += step >> 1;
+    if(nibble & 1) diff += step >> 2;
+    int32_t predictor = state->predictor + ((nibble & 8) ? -diff : diff);
+    if(predictor > INT16_MAX) predictor = INT16_MAX;
+    if(predictor < INT16_MIN) predictor = INT16_MIN;
+    state->predictor = predictor;
+    int index = state->step_index + pcm_index_table[nibble & 7];
+    state->step_index = index < 0 ? 0 : index > 88 ? 88 : index;
+}
+
+uint8_t pcm_adpcm_encode(PcmState* state, uint8_t sample) {
+    int32_t diff = (((int32_t)sample - 128) << 8) - state->predictor;
+    int32_t step = pcm_step_table[state->step_index];
+    uint8_t nibble = 0;
+    if(diff < 0) {
+        nibble = 8;
+        diff = -diff;
+    }
+    if(diff >= step) {
+        nibble |= 4;
+        diff -= step;
+    }
+    if(diff >= step >> 1) {
+        nibble |= 2;
+        diff -= step >> 1;
+    }
+    if(diff >= step >> 2) nibble |= 1;
+    pcm_adpcm_step(state, nibble);
+    return nibble;
+}
+
+uint8_t pcm_adpcm_decode(PcmState* state, uint8_t nibble) {
+    pcm_adpcm_step(state, nibble);
+    return (uint8_t)((state->predictor >> 8) + 128);
+}
+
+// Read bytes at an offset of the asset, true if all of them arrived
+static bool pcm_read(const char* path, uint32_t offset, void* buffer, size_t size) {
+    bool read = false;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        read = storage_file_seek(file, offset, true) && storage_file_read(file, buffer, size) == size;
+    }
+    storage_file_close(file);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    return read;
+}
+
+bool pcm_cache_open(PcmCache* cache, const char* path) {
+    memset(cache, 0, sizeof(PcmCache));
+    cache->path = path;
+    PcmHeader header;
+    if(!pcm_read(path, 0, &header, sizeof(header))) return false;
+    if(header.magic != PCM_MAGIC || header.version != PCM_VERSION || header.sample_rate == 0) return false;
+    cache->count = header.count < PCM_MAX_PHRASES ? header.count : PCM_MAX_PHRASES;
+    cache->sample_rate = header.sample_rate;
+    cache->opened = pcm_read(path, sizeof(header), cache->index, cache->count * sizeof(PcmPhraseIndex));
+    return cache->opened;
+}
+
+static void pcm_cache_evict(PcmCache* cache, uint8_t phrase) {
+    free(cache->data[phrase]);
+    cache->data[phrase] = NULL;
+    cache->resident_bytes -= PCM_ADPCM_BYTES(cache->index[phrase].samples);
+    cache->evictions++;
+}
+
+void pcm_cache_close(PcmCache* cache) {
+    for(uint8_t i = 0; i < cache->count; i++) {
+        if(cache->data[i]) pcm_cache_evict(cache, i);
+    }
+    cache->opened = false;
+}
+
+const uint8_t* pcm_cache_get(PcmCache* cache, uint8_t phrase) {
+    if(!cache->opened || phrase >= cache->count || cache->index[phrase].samples == 0) return NULL;
+    cache->last_used[phrase] = ++cache->use_clock;
+    if(cache->data[phrase]) return cache->data[phrase];
+
+    uint32_t bytes = PCM_ADPCM_BYTES(cache->index[phrase].samples);
+    if(bytes > PCM_CACHE_BYTES) return NULL; // Never fits, let SAM say it
+    while(cache->resident_bytes + bytes > PCM_CACHE_BYTES) {
+        int oldest = -1;
+        for(uint8_t i = 0; i < cache->count; i++) {
+            if(cache->data[i] && (oldest < 0 || cache->last_used[i] < cache->last_used[oldest])) oldest = i;
+        }
+        pcm_cache_evict(cache, oldest);
+    }
+    uint8_t* data = malloc(bytes);
+    if(!data) return NULL;
+    if(!pcm_read(cache->path, cache->index[phrase].offset, data, bytes)) {
+        free(data);
+        return NULL;
+    }
+    cache->data[phrase] = data;
+    cache->resident_bytes += bytes;
+    return data;
+}
+
+void pcm_play(const PcmCache* cache, uint8_t phrase, const uint8_t* data) {
+    const PcmPhraseIndex* entry = &cache->index[phrase];
+    PcmState state = {entry->predictor, entry->step_index};
+    // Duty cycle follows the sample; the carrier is far above what the speaker passes
+    furi_hal_speaker_start(PCM_PWM_HZ, 0.5f);
+    uint32_t start = perf_clock();
+    for(uint32_t i = 0; i < entry->samples; i++) {
+        uint8_t nibble = (i & 1) ? data[i / 2] >> 4 : data[i / 2] & 0x0F;
+        uint8_t sample = pcm_adpcm_decode(&state, nibble);
+        uint32_t due_us = (uint32_t)((uint64_t)i * 1000000 / cache->sample_rate);
+        while(perf_elapsed_us(start) < due_us) {
+            // Spin on the worker thread; the game threads run at higher priority
+        }
+        furi_hal_speaker_set_volume(sample / 255.0f);
+    }
+    furi_hal_speaker_stop();
+}
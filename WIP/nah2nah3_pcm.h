@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Pre-synthesized phrases as 4-bit IMA ADPCM, so fixed lines are not run
+// through SAM again every time. host/pcm_pack.c builds the asset from raw
+// 8-bit PCM; the cache keeps recently used phrases in RAM under a byte cap.
+
+#define PCM_MAGIC 0x534E4148U // "NAHS" little endian
+#define PCM_VERSION 1
+#define PCM_MAX_PHRASES 32
+#define PCM_CACHE_BYTES (12 * 1024) // ~3s of speech at 8kHz
+#define PCM_PWM_HZ 62500 // Speaker carrier while streaming, well above hearing
+
+// Asset layout: PcmHeader, PcmPhraseIndex[count], then ADPCM data
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t count;
+    uint16_t sample_rate;
+} PcmHeader;
+
+typedef struct {
+    uint32_t offset; // From the start of the file
+    uint32_t samples; // 0 when the phrase was not packed
+    int16_t predictor; // Decoder state at the first sample
+    uint8_t step_index;
+    uint8_t reserved;
+} PcmPhraseIndex;
+
+typedef struct {
+    int16_t predictor;
+    uint8_t step_index;
+} PcmState;
+
+typedef struct {
+    const char* path;
+    bool opened; // Index read, false if the asset is missing
+    uint16_t sample_rate;
+    uint8_t count;
+    PcmPhraseIndex index[PCM_MAX_PHRASES];
+    uint8_t* data[PCM_MAX_PHRASES]; // NULL when not resident
+    uint32_t last_used[PCM_MAX_PHRASES];
+    uint32_t use_clock;
+    uint32_t resident_bytes;
+    uint32_t evictions;
+} PcmCache;
+
+// Bytes of ADPCM for a phrase of this many samples
+#define PCM_ADPCM_BYTES(samples) (((samples) + 1) / 2)
+
+// One 8-bit unsigned sample in, one nibble out; state carries across calls
+uint8_t pcm_adpcm_encode(PcmState* state, uint8_t sample);
+uint8_t pcm_adpcm_decode(PcmState* state, uint8_t nibble);
+
+// Read the asset index; phrases load on first use
+bool pcm_cache_open(PcmCache* cache, const char* path);
+void pcm_cache_close(PcmCache* cache);
+
+// Resident ADPCM for a phrase, loading it and evicting least recently used
+// ones to stay under PCM_CACHE_BYTES. NULL if it is not in the asset.
+const uint8_t* pcm_cache_get(PcmCache* cache, uint8_t phrase);
+
+// Decode and stream a phrase on the speaker PWM; the caller owns the speaker
+void pcm_play(const PcmCache* cache, uint8_t phrase, const uint8_t* data);
@@ -0,0 +1,171 @@
+#include "nah2nah3_perf.h"
+
+#include <furi.h>
+#include <string.h>
+#include <storage/storage.h>
+#if NAH_HOST
+#include <time.h>
+#else
+#include <furi_hal.h>
+#endif
+
+#define PERF_TRACE_PATH APP_DATA_PATH("perf.bin")
+
+const char* const perf_phase_names[PERF_PHASE_COUNT] = {
+    "input", "tick", "zero", "zip", "car", "iq", "tect", "space", "anim", "pub", "draw"};
+
+const char* const perf_stack_names[PERF_STACK_COUNT] = {"app", "timer", "gui", "input", "tts"};
+
+static void perf_window_reset(PerfStats* stats, uint32_t now) {
+    stats->window_start = now;
+    stats->count = 0;
+    stats->min_us = UINT32_MAX;
+    stats->max_us = 0;
+    stats->total_us = 0;
+    memset(stats->histogram, 0, sizeof(stats->histogram));
+}
+
+static uint8_t perf_bucket(uint32_t us) {
+    uint8_t bucket = 0;
+    while(us > 1 && bucket < PERF_BUCKETS - 1) {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+// Finish the window into the report the overlay reads
+static void perf_window_roll(PerfStats* stats, uint32_t now) {
+    PerfReport* report = &stats->report;
+    uint32_t rank = stats->count - stats->count / 100; // Samples at or below p99
+    uint32_t seen = 0;
+    uint32_t p99 = stats->max_us;
+    for(uint8_t i = 0; i < PERF_BUCKETS - 1; i++) {
+        seen += stats->histogram[i];
+        if(seen >= rank) {
+            p99 = (2U << i) - 1;
+            break;
+        }
+    }
+    report->min_us = stats->min_us;
+    report->avg_us = (uint32_t)(stats->total_us / stats->count);
+    report->p99_us = p99 < stats->max_us ? p99 : stats->max_us;
+    report->max_us = stats->max_us;
+    memcpy(report->histogram, stats->histogram, sizeof(report->histogram));
+    stats->windows++;
+    perf_window_reset(stats, now);
+}
+
+void perf_init(Perf* perf) {
+    memset(perf, 0, sizeof(Perf));
+    uint32_t now = furi_get_tick();
+    for(int i = 0; i < PERF_PHASE_COUNT; i++) perf_window_reset(&perf->phases[i], now);
+    for(int i = 0; i < PERF_STACK_COUNT; i++) perf->stack_free[i] = PERF_STACK_UNKNOWN;
+    atomic_store(&perf->trace_head, 0);
+    atomic_store(&perf->trace_tail, 0);
+}
+
+uint32_t perf_clock(void) {
+#if NAH_HOST
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+uint32_t perf_elapsed_us(uint32_t start) {
+    uint32_t elapsed = perf_clock() - start; // Wraps cleanly before converting
+#if NAH_HOST
+    return elapsed / 1000;
+#else
+    return elapsed / furi_hal_cortex_instructions_per_microsecond();
+#endif
+}
+
+void perf_end(Perf* perf, PerfPhase phase, uint32_t start) {
+    uint32_t us = perf_elapsed_us(start);
+    PerfStats* stats = &perf->phases[phase];
+    stats->count++;
+    stats->total_us += us;
+    if(us < stats->min_us) stats->min_us = us;
+    if(us > stats->max_us) stats->max_us = us;
+    uint16_t* bucket = &stats->histogram[perf_bucket(us)];
+    if(*bucket < UINT16_MAX) (*bucket)++;
+    uint16_t clamped = us > UINT16_MAX ? UINT16_MAX : us;
+    if(clamped > stats->peak_us) stats->peak_us = clamped;
+    if(phase == PERF_PHASE_RENDER && perf->frames < UINT8_MAX) perf->frames++;
+
+    uint32_t now = furi_get_tick();
+    if(stats->count >= PERF_WINDOW_SAMPLES || now - stats->window_start >= PERF_WINDOW_MS) {
+        perf_window_roll(stats, now);
+    }
+}
+
+void perf_trace_tick(Perf* perf, uint32_t now, uint8_t state, uint8_t capacity) {
+    if(!perf->overlay) return;
+    unsigned head = atomic_load(&perf->trace_head);
+    if(head - atomic_load(&perf->trace_tail) >= PERF_TRACE_RECORDS) {
+        perf->trace_dropped++; // Flush fell behind, keep the older records
+        return;
+    }
+    PerfTraceRecord* record = &perf->trace[head % PERF_TRACE_RECORDS];
+    record->time_ms = now;
+    record->state = state;
+    record->capacity = capacity;
+    record->frames = perf->frames;
+    perf->frames = 0;
+    for(int i = 0; i < PERF_PHASE_COUNT; i++) {
+        record->us[i] = perf->phases[i].peak_us;
+        perf->phases[i].peak_us = 0;
+    }
+    atomic_store(&perf->trace_head, head + 1);
+}
+
+void perf_trace_flush(Perf* perf) {
+    bool tracing = perf->overlay;
+    unsigned tail = atomic_load(&perf->trace_tail);
+    unsigned pending = atomic_load(&perf->trace_head) - tail;
+    // Batch writes while tracing; drain whatever is left once it stops
+    if(tracing ? pending < PERF_TRACE_RECORDS / 2 : pending == 0) {
+        if(!tracing) perf->trace_started = false;
+        return;
+    }
+    PerfTraceHeader header = {PERF_TRACE_MAGIC, PERF_TRACE_VERSION, PERF_PHASE_COUNT, sizeof(PerfTraceRecord)};
+    unsigned first = tail % PERF_TRACE_RECORDS;
+    unsigned run = pending < PERF_TRACE_RECORDS - first ? pending : PERF_TRACE_RECORDS - first;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    if(storage_file_open(file, PERF_TRACE_PATH, FSAM_WRITE, perf->trace_started ? FSOM_OPEN_APPEND : FSOM_CREATE_ALWAYS)) {
+        if(!perf->trace_started) storage_file_write(file, &header, sizeof(header));
+        storage_file_write(file, &perf->trace[first], run * sizeof(PerfTraceRecord));
+        storage_file_write(file, &perf->trace[0], (pending - run) * sizeof(PerfTraceRecord));
+    }
+    storage_file_close(file);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    perf->trace_started = tracing;
+    atomic_store(&perf->trace_tail, tail + pending);
+}
+
+void perf_stack_sample(Perf* perf, PerfStack stack, FuriThreadId thread) {
+#if NAH_HOST
+    UNUSED(perf);
+    UNUSED(stack);
+    UNUSED(thread);
+#else
+    if(!thread) return;
+    uint32_t free_bytes = furi_thread_get_stack_space(thread);
+    if(free_bytes < perf->stack_free[stack]) perf->stack_free[stack] = free_bytes;
+#endif
+}
+
+PerfStack perf_stack_tightest(const Perf* perf) {
+    PerfStack tightest = PERF_STACK_COUNT;
+    for(int i = 0; i < PERF_STACK_COUNT; i++) {
+        if(perf->stack_free[i] == PERF_STACK_UNKNOWN) continue;
+        if(tightest == PERF_STACK_COUNT || perf->stack_free[i] < perf->stack_free[tightest]) tightest = i;
+    }
+    return tightest;
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <furi.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+// Per-phase timing for input, the timer tick, each game update and the draw.
+// Every phase is recorded by exactly one thread, so the stats need no locking;
+// the overlay and the trace only read finished values and tolerate a torn one.
+
+#define PERF_BUCKETS 12 // Log2 histogram: <2us, <4us ... >=2048us
+#define PERF_WINDOW_SAMPLES 256 // Roll the window after this many samples...
+#define PERF_WINDOW_MS 1000 // ...or this long, for phases that run rarely
+#define PERF_OVERLAY_ROWS 4 // Tick, the running update, draw and input
+#define PERF_TRACE_RECORDS 64 // One record per tick, ~3s of headroom for the flush
+#define PERF_TRACE_MAGIC 0x5048414EU // "NAHP" little endian
+#define PERF_TRACE_VERSION 2
+#define PERF_STACK_BUDGET 512 // Free bytes each thread should keep at its deepest
+#define PERF_STACK_UNKNOWN UINT16_MAX // Not sampled yet, or a host build
+
+typedef enum {
+    PERF_PHASE_INPUT,
+    PERF_PHASE_TICK, // Whole timer callback, includes the phases below
+    PERF_PHASE_ZERO_HERO,
+    PERF_PHASE_FLIP_ZIP,
+    PERF_PHASE_LINE_CAR,
+    PERF_PHASE_FLIP_IQ,
+    PERF_PHASE_TECTONE_SIM,
+    PERF_PHASE_SPACE_FLIGHT,
+    PERF_PHASE_ANIMATIONS,
+    PERF_PHASE_PUBLISH,
+    PERF_PHASE_RENDER,
+    PERF_PHASE_COUNT
+} PerfPhase;
+
+// Threads the app runs code on; the app thread's stack is stack_size in application.fam
+typedef enum {
+    PERF_STACK_APP,
+    PERF_STACK_TIMER,
+    PERF_STACK_GUI,
+    PERF_STACK_INPUT,
+    PERF_STACK_TTS,
+    PERF_STACK_COUNT
+} PerfStack;
+
+// Summary of the last complete window
+typedef struct {
+    uint32_t min_us;
+    uint32_t avg_us;
+    uint32_t p99_us; // Upper edge of the p99 bucket, capped at max_us
+    uint32_t max_us;
+    uint16_t histogram[PERF_BUCKETS];
+} PerfReport;
+
+typedef struct {
+    uint32_t window_start;
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint16_t histogram[PERF_BUCKETS];
+    uint16_t peak_us; // Worst since the last trace record, 0 if the phase did not run
+    uint16_t windows; // Reports finished so far, a change means a new report
+    PerfReport report;
+} PerfStats;
+
+// Trace file: PerfTraceHeader, then PerfTraceRecord until the trace stops
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t phase_count;
+    uint16_t record_size;
+} PerfTraceHeader;
+
+typedef struct {
+    uint32_t time_ms;
+    uint8_t state;
+    uint8_t frames; // Draws since the previous record
+    uint8_t capacity; // Adaptive object cap, in steps of CAPACITY_FULL
+    uint16_t us[PERF_PHASE_COUNT]; // Worst time per phase since the previous record
+} PerfTraceRecord;
+
+typedef struct {
+    PerfStats phases[PERF_PHASE_COUNT];
+    uint8_t frames; // Draws since the last trace record
+    bool overlay; // Overlay and SD trace, toggled with OK held + Back
+    bool combo_ok_held;
+    bool combo_back_swallow; // Eat the rest of the Back press that toggled the overlay
+    // Single producer (timer thread), single consumer (app main loop)
+    PerfTraceRecord trace[PERF_TRACE_RECORDS];
+    atomic_uint trace_head;
+    atomic_uint trace_tail;
+    bool trace_started; // Header written, append from here on
+    uint32_t trace_dropped;
+    uint16_t stack_free[PERF_STACK_COUNT]; // Least free stack bytes seen per thread
+} Perf;
+
+void perf_init(Perf* perf);
+
+// Raw timestamp: DWT cycles on device, monotonic ns on host
+uint32_t perf_clock(void);
+uint32_t perf_elapsed_us(uint32_t start);
+
+// Close a phase opened with perf_clock()
+void perf_end(Perf* perf, PerfPhase phase, uint32_t start);
+
+// Timer thread, once per tick: queue a trace record while the overlay is on
+void perf_trace_tick(Perf* perf, uint32_t now, uint8_t state, uint8_t capacity);
+
+// App main loop: write queued records to the SD card, never from the timer
+void perf_trace_flush(Perf* perf);
+
+// Fold a thread's stack high-water mark into stack_free. The kernel paints each
+// stack at creation, so any sample sees the deepest use so far. No-op on host,
+// where -fstack-usage reports the frames instead (see host/Readme.md).
+void perf_stack_sample(Perf* perf, PerfStack stack, FuriThreadId thread);
+
+// Thread with the least free stack, PERF_STACK_COUNT if none was sampled
+PerfStack perf_stack_tightest(const Perf* perf);
+
+extern const char* const perf_phase_names[PERF_PHASE_COUNT];
+extern const char* const perf_stack_names[PERF_STACK_COUNT];
@@ -0,0 +1,63 @@
+#include "nah2nah3_plan.h"
+
+// Every row of 1 to 5 obstacles, grouped by obstacle count
+static const uint8_t plan_masks[] = {
+    0x01, 0x02, 0x04, 0x08, 0x10,
+    0x03, 0x05, 0x06, 0x09, 0x0A, 0x0C, 0x11, 0x12, 0x14, 0x18,
+    0x07, 0x0B, 0x0D, 0x0E, 0x13, 0x15, 0x16, 0x19, 0x1A, 0x1C,
+    0x0F, 0x17, 0x1B, 0x1D, 0x1E,
+    0x1F,
+};
+static const uint8_t plan_mask_first[PLAN_LANES + 2] = {0, 0, 5, 15, 25, 30, 31};
+
+static uint8_t plan_spread(uint8_t lanes, int moves) {
+    for(int i = 0; i < moves && lanes != PLAN_ALL_LANES; i++) {
+        lanes |= ((lanes << 1) | (lanes >> 1)) & PLAN_ALL_LANES;
+    }
+    return lanes;
+}
+
+void plan_start(PlanReach* reach, uint8_t lanes, int cooldown) {
+    for(int i = 0; i <= PLAN_COOLDOWN_MAX; i++) reach->lanes[i] = 0;
+    if(cooldown < 0) cooldown = 0;
+    if(cooldown > PLAN_COOLDOWN_MAX) cooldown = PLAN_COOLDOWN_MAX;
+    reach->lanes[cooldown] = lanes & PLAN_ALL_LANES;
+}
+
+void plan_step(PlanReach* reach, const PlanLimits* limits, int gap, uint8_t walls) {
+    if(gap < 0) gap = 0;
+    int moves = limits->lane_ticks ? gap / limits->lane_ticks : PLAN_LANES;
+    int jump = limits->jump_ticks > PLAN_COOLDOWN_MAX ? PLAN_COOLDOWN_MAX : limits->jump_ticks;
+    PlanReach next = {0};
+    for(int wait = 0; wait <= PLAN_COOLDOWN_MAX; wait++) {
+        if(!reach->lanes[wait]) continue;
+        uint8_t lanes = plan_spread(reach->lanes[wait], moves);
+        int left = wait > gap ? wait - gap : 0;
+        next.lanes[left] |= lanes & ~walls; // Open lanes pass on foot
+        if(left == 0) next.lanes[jump] |= lanes & walls; // Grounded, so it jumps the row
+    }
+    // A lane that can jump sooner covers the same lane waiting longer
+    uint8_t seen = 0;
+    for(int wait = 0; wait <= PLAN_COOLDOWN_MAX; wait++) {
+        next.lanes[wait] &= ~seen;
+        seen |= next.lanes[wait];
+    }
+    *reach = next;
+}
+
+uint8_t plan_row(const PlanReach* reach, const PlanLimits* limits, int gap, int walls, uint8_t allowed, uint32_t random) {
+    if(walls > PLAN_LANES) walls = PLAN_LANES;
+    for(int count = walls; count > 0; count--) {
+        int first = plan_mask_first[count];
+        int total = plan_mask_first[count + 1] - first;
+        int start = random % total;
+        for(int i = 0; i < total; i++) {
+            uint8_t row = plan_masks[first + (start + i) % total];
+            if(row & ~allowed) continue;
+            PlanReach next = *reach;
+            plan_step(&next, limits, gap, row);
+            if(plan_alive(&next)) return row;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Lookahead for obstacle rows in the lane games. The lanes a player can still
+// be in after a run of rows are kept as 5-bit masks, one per update left until
+// the next jump. A new row is only placed if some lane survives it, so every
+// row on screen has a way through. The model is cautious: a jump clears one
+// row, a held jump clears nothing more, and lane changes never carry over
+// from one gap to the next.
+
+#define PLAN_LANES 5
+#define PLAN_ALL_LANES ((1 << PLAN_LANES) - 1)
+#define PLAN_COOLDOWN_MAX 15 // Updates tracked until the next jump, longer jumps clamp here
+
+typedef struct {
+    uint8_t lane_ticks; // Updates per lane change, reaction included
+    uint8_t jump_ticks; // Updates from a jump until the next can start
+} PlanLimits;
+
+typedef struct {
+    uint8_t lanes[PLAN_COOLDOWN_MAX + 1]; // Reachable lanes by updates until the next jump
+} PlanReach;
+
+void plan_start(PlanReach* reach, uint8_t lanes, int cooldown);
+
+static inline bool plan_alive(const PlanReach* reach) {
+    uint8_t any = 0;
+    for(int i = 0; i <= PLAN_COOLDOWN_MAX; i++) any |= reach->lanes[i];
+    return any != 0;
+}
+
+// Advance past a row that reaches the player gap updates after the last one
+void plan_step(PlanReach* reach, const PlanLimits* limits, int gap, uint8_t walls);
+
+// Row of at most walls obstacles, only in allowed lanes, that leaves some
+// lane alive after reach. Fewer obstacles when no placement fits, 0 if none.
+uint8_t plan_row(const PlanReach* reach, const PlanLimits* limits, int gap, int walls, uint8_t allowed, uint32_t random);
@@ -0,0 +1,80 @@
+#include "nah2nah3_pool.h"
+
+#include <string.h>
+
+void pool_clear(EntityPool* pool) {
+    pool->count = 0;
+    pool_rebuild(pool);
+}
+
+uint8_t pool_spawn(EntityPool* pool, uint8_t lane) {
+    if(!pool->free_count) return POOL_NONE;
+    uint8_t id = pool->free[--pool->free_count];
+    pool->x[id] = 0;
+    pool->y[id] = 0;
+    pool->size[id] = 0;
+    pool->z[id] = 0;
+    pool->vy[id] = 0;
+    pool->sub_y[id] = 0;
+    pool->type[id] = 0;
+    pool->lane[id] = lane;
+    pool->slot[id] = pool->count;
+    pool->active[pool->count++] = id;
+    if(lane < POOL_LANES) pool->lane_count[lane]++;
+    return id;
+}
+
+void pool_kill(EntityPool* pool, uint8_t id) {
+    uint8_t slot = pool->slot[id];
+    if(slot == POOL_NONE) return;
+    uint8_t last = pool->active[--pool->count];
+    pool->active[slot] = last;
+    pool->slot[last] = slot;
+    pool->slot[id] = POOL_NONE;
+    pool->free[pool->free_count++] = id;
+    if(pool->lane[id] < POOL_LANES) pool->lane_count[pool->lane[id]]--;
+}
+
+void pool_rebuild(EntityPool* pool) {
+    if(pool->count > POOL_SIZE) pool->count = 0;
+    memset(pool->slot, POOL_NONE, sizeof(pool->slot));
+    memset(pool->lane_count, 0, sizeof(pool->lane_count));
+    for(uint8_t i = 0; i < pool->count; i++) {
+        uint8_t id = pool->active[i];
+        if(id >= POOL_SIZE || pool->slot[id] != POOL_NONE) { // Damaged list, start empty
+            pool_clear(pool);
+            return;
+        }
+        pool->slot[id] = i;
+        if(pool->lane[id] < POOL_LANES) pool->lane_count[pool->lane[id]]++;
+    }
+    pool->free_count = 0;
+    for(int id = POOL_SIZE - 1; id >= 0; id--) {
+        if(pool->slot[id] == POOL_NONE) pool->free[pool->free_count++] = id;
+    }
+}
+
+void pool_publish(const EntityPool* pool, EntityList* list) {
+    for(uint8_t i = 0; i < pool->count; i++) {
+        uint8_t id = pool->active[i];
+        list->x[i] = pool->x[id];
+        list->y[i] = pool->y[id];
+        list->size[i] = pool->size[id];
+        list->type[i] = pool->type[id];
+        list->lane[i] = pool->lane[id];
+    }
+    list->count = pool->count;
+}
+
+void pool_bucket(const EntityPool* pool, PoolBuckets* buckets) {
+    uint8_t next[POOL_LANES];
+    buckets->start[0] = 0;
+    for(int lane = 0; lane < POOL_LANES; lane++) {
+        next[lane] = buckets->start[lane];
+        buckets->start[lane + 1] = buckets->start[lane] + pool->lane_count[lane];
+    }
+    for(uint8_t i = 0; i < pool->count; i++) {
+        uint8_t id = pool->active[i];
+        if(pool->lane[id] < POOL_LANES) buckets->ids[next[pool->lane[id]]++] = id;
+    }
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Entities of every game in one structure-of-arrays pool. Fields are indexed
+// by a stable id; the live ids are kept packed in active[], so update and draw
+// loops touch only what is alive. Freed ids go on a stack and the lowest
+// unused id comes out first, so a game that keeps at most N alive only ever
+// sees ids below N.
+
+#define POOL_SIZE 50 // Every lane full in Zero Hero or Flip Zip, checked in nah2nah3.c
+#define POOL_LANES 5
+#define POOL_NONE 0xFF
+#define POOL_NO_LANE POOL_NONE // Entities outside the lane games
+#define POOL_SUBPX_SHIFT 8 // vy and sub_y are in 1/256 px
+
+typedef struct {
+    int16_t x[POOL_SIZE];
+    int16_t y[POOL_SIZE];
+    int16_t size[POOL_SIZE]; // Length, width or radius, per game
+    int16_t z[POOL_SIZE]; // Depth, Space Flight
+    int16_t vy[POOL_SIZE]; // Falling speed per update, for pool_fall
+    uint8_t type[POOL_SIZE]; // Per-game kind or flags
+    uint8_t lane[POOL_SIZE];
+    uint8_t sub_y[POOL_SIZE]; // Fraction of a pixel below y
+    uint8_t active[POOL_SIZE]; // Live ids, packed
+    uint8_t slot[POOL_SIZE]; // Index of each live id in active[], POOL_NONE when free
+    uint8_t free[POOL_SIZE]; // Stack of free ids, top at free_count - 1
+    uint8_t count;
+    uint8_t free_count;
+    uint8_t lane_count[POOL_LANES]; // Live entities per lane
+} EntityPool;
+
+// Live ids grouped by lane: lane l holds ids[start[l]] up to ids[start[l + 1]]
+typedef struct {
+    uint8_t start[POOL_LANES + 1];
+    uint8_t ids[POOL_SIZE];
+} PoolBuckets;
+
+// Live entities copied out in active[] order, for the render snapshot
+typedef struct {
+    int16_t x[POOL_SIZE];
+    int16_t y[POOL_SIZE];
+    int16_t size[POOL_SIZE];
+    uint8_t type[POOL_SIZE];
+    uint8_t lane[POOL_SIZE];
+    uint8_t count;
+} EntityList;
+
+void pool_clear(EntityPool* pool);
+
+// Zeroed entity in the lane, POOL_NONE when the pool is full
+uint8_t pool_spawn(EntityPool* pool, uint8_t lane);
+
+// The last live entity takes the freed place in active[]. Loops that kill
+// while walking active[] go from the end, so nothing is skipped.
+void pool_kill(EntityPool* pool, uint8_t id);
+
+// Rebuild slot[], the free stack and lane counts after active[] and count
+// were restored, as a suspended game does
+void pool_rebuild(EntityPool* pool);
+
+void pool_publish(const EntityPool* pool, EntityList* list);
+
+// Counting sort of the live ids by lane, from the lane counts; ids outside
+// the lanes are left out
+void pool_bucket(const EntityPool* pool, PoolBuckets* buckets);
+
+static inline bool pool_live(const EntityPool* pool, uint8_t id) {
+    return pool->slot[id] != POOL_NONE;
+}
+
+// One semi-implicit Euler step: gain gravity up to terminal, then move by
+// the new speed, carrying the fraction of a pixel to the next step
+static inline void pool_fall(EntityPool* pool, uint8_t id, int16_t gravity, int16_t terminal) {
+    int vy = pool->vy[id] + gravity;
+    if(vy > terminal) vy = terminal;
+    pool->vy[id] = vy;
+    int sub = pool->sub_y[id] + vy;
+    pool->y[id] += sub >> POOL_SUBPX_SHIFT;
+    pool->sub_y[id] = sub & ((1 << POOL_SUBPX_SHIFT) - 1);
+}
@@ -0,0 +1,34 @@
+#include "nah2nah3_render.h"
+
+#include <string.h>
+
+void render_buffer_init(RenderBuffer* buffer) {
+    memset(buffer->snapshots, 0, sizeof(buffer->snapshots));
+    atomic_store(&buffer->front, 0);
+    atomic_store(&buffer->reading, RENDER_NONE);
+}
+
+RenderSnapshot* render_buffer_back(RenderBuffer* buffer) {
+    uint8_t back = atomic_load(&buffer->front) ^ 1;
+    // Reader still on the old front; skip this frame rather than tear it
+    if(atomic_load(&buffer->reading) == back) return NULL;
+    return &buffer->snapshots[back];
+}
+
+void render_buffer_publish(RenderBuffer* buffer) {
+    atomic_store(&buffer->front, atomic_load(&buffer->front) ^ 1);
+}
+
+const RenderSnapshot* render_buffer_acquire(RenderBuffer* buffer) {
+    uint8_t index;
+    // Claim the front, then check it did not move before the claim was visible
+    do {
+        index = atomic_load(&buffer->front);
+        atomic_store(&buffer->reading, index);
+    } while(atomic_load(&buffer->front) != index);
+    return &buffer->snapshots[index];
+}
+
+void render_buffer_release(RenderBuffer* buffer) {
+    atomic_store(&buffer->reading, RENDER_NONE);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "nah2nah3.h"
+
+// Lock-free hand-off of RenderSnapshot from the timer thread to the GUI thread.
+// One writer and one reader; the writer never touches the snapshot being drawn.
+
+#define RENDER_NONE 0xFF
+
+void render_buffer_init(RenderBuffer* buffer);
+
+// Snapshot to fill for the next frame, NULL if the GUI thread is still drawing it
+RenderSnapshot* render_buffer_back(RenderBuffer* buffer);
+
+// Make the back snapshot the latest one
+void render_buffer_publish(RenderBuffer* buffer);
+
+// Latest snapshot, held until render_buffer_release()
+const RenderSnapshot* render_buffer_acquire(RenderBuffer* buffer);
+void render_buffer_release(RenderBuffer* buffer);
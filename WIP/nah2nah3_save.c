@@ -0,0 +1,40 @@
+#include "nah2nah3_save.h"
+
+#include <furi.h>
+#include <storage/storage.h>
+
+size_t save_read(const char* path, void* data, size_t size) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    size_t read = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING) ? storage_file_read(file, data, size) : 0;
+    storage_file_close(file);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    return read;
+}
+
+size_t save_read_any(const char* path, const char* temp_path, void* data, size_t size) {
+    size_t read = save_read(path, data, size);
+    return read ? read : save_read(temp_path, data, size);
+}
+
+bool save_write(const char* path, const char* temp_path, const void* data, size_t size) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    bool written = storage_file_open(file, temp_path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                   storage_file_write(file, data, size) == size && storage_file_sync(file);
+    storage_file_close(file);
+    storage_file_free(file);
+    if(written) {
+        storage_common_remove(storage, path); // Rename will not replace a file
+        written = storage_common_rename(storage, temp_path, path) == FSE_OK;
+    }
+    furi_record_close(RECORD_STORAGE);
+    return written;
+}
+
+void save_remove(const char* path) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_common_remove(storage, path);
+    furi_record_close(RECORD_STORAGE);
+}
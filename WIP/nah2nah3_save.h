@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Whole-file reads and writes on the Storage API for the small files the app
+// keeps in apps_data: the stats and the suspend snapshot. Writes go to a temp
+// name first and are renamed over the old file, so a crash keeps the old one.
+
+// One read of up to size bytes; returns how many arrived, 0 if there is no file
+size_t save_read(const char* path, void* data, size_t size);
+
+// Write data to temp_path, then replace path with it. If the app stops between
+// the two steps, only temp_path is left; save_read_any picks it up.
+bool save_write(const char* path, const char* temp_path, const void* data, size_t size);
+
+// save_read of path, falling back to temp_path
+size_t save_read_any(const char* path, const char* temp_path, void* data, size_t size);
+
+void save_remove(const char* path);
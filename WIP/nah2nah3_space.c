@@ -0,0 +1,66 @@
+#include "nah2nah3_space.h"
+
+#include <string.h>
+
+// Rounded at compile time, so there is no divide on the device
+#define SPACE_SCALE(z) \
+    (uint16_t)(((SPACE_FOCAL << SPACE_SCALE_SHIFT) + ((z) + SPACE_NEAR) / 2) / ((z) + SPACE_NEAR))
+#define SPACE_SCALE4(z) SPACE_SCALE(z), SPACE_SCALE((z) + 1), SPACE_SCALE((z) + 2), SPACE_SCALE((z) + 3)
+#define SPACE_SCALE16(z) SPACE_SCALE4(z), SPACE_SCALE4((z) + 4), SPACE_SCALE4((z) + 8), SPACE_SCALE4((z) + 12)
+
+const uint16_t space_scale[SPACE_DEPTHS] = {
+    SPACE_SCALE16(0),
+    SPACE_SCALE16(16),
+    SPACE_SCALE16(32),
+    SPACE_SCALE16(48),
+};
+
+// Per speed step, by screen_type
+static const SpaceVelocity space_maneuvers[SPACE_MANEUVERS] = {
+    {0, 0, -1}, // Forward
+    {0, -8, -1}, // Upward, objects rise away from the ship
+    {0, 8, -1}, // Downward
+    {-16, 0, -1}, // Strafe left pushes objects left
+    {16, 0, -1}, // Strafe right
+    {0, 0, -3}, // Loop
+    {0, 0, -3}, // Barrel roll
+    {0, 0, -1},
+    {0, 0, -1}, // Dock
+};
+
+void space_velocity(SpaceVelocity* velocity, int screen_type, int speed) {
+    const SpaceVelocity* maneuver = &space_maneuvers[screen_type >= 0 && screen_type < SPACE_MANEUVERS ? screen_type : 0];
+    velocity->dx = maneuver->dx * speed;
+    velocity->dy = maneuver->dy * speed;
+    velocity->dz = maneuver->dz * speed;
+}
+
+// Sort position of a depth, 0 for the spawn plane and beyond
+static int space_rank(int z) {
+    return z > SPACE_Z_FAR ? 0 : z < 0 ? SPACE_Z_FAR : SPACE_Z_FAR - z;
+}
+
+void space_publish(const EntityPool* pool, EntityList* list) {
+    uint8_t start[SPACE_DEPTHS]; // Counting sort, farthest depth first
+    memset(start, 0, sizeof(start));
+    for(uint8_t i = 0; i < pool->count; i++) {
+        start[space_rank(pool->z[pool->active[i]])]++;
+    }
+    uint8_t total = 0;
+    for(int d = 0; d < SPACE_DEPTHS; d++) {
+        uint8_t count = start[d];
+        start[d] = total;
+        total += count;
+    }
+    for(uint8_t i = 0; i < pool->count; i++) {
+        uint8_t id = pool->active[i];
+        uint8_t n = start[space_rank(pool->z[id])]++;
+        SpacePoint point = space_project(pool, id);
+        list->x[n] = point.x;
+        list->y[n] = point.y;
+        list->size[n] = point.size;
+        list->type[n] = pool->type[id];
+        list->lane[n] = pool->lane[id];
+    }
+    list->count = pool->count;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "nah2nah3_pool.h"
+
+// Space Flight depth model. Objects keep world x and y, offsets from the line
+// of sight, and a depth z counting down from the spawn plane to the ship. A
+// table of scales by depth projects them, so the update and draw loops only
+// multiply and shift. Movement comes from one velocity per maneuver, scaled
+// once per update for the speed.
+
+#define SPACE_DEPTHS 64 // Depth steps from the ship plane (0) to the spawn plane
+#define SPACE_Z_FAR (SPACE_DEPTHS - 1)
+#define SPACE_NEAR 8 // Eye to the ship plane, in depth steps
+#define SPACE_FOCAL (SPACE_Z_FAR + SPACE_NEAR) // Scale 1 at the spawn plane
+#define SPACE_SCALE_SHIFT 8
+#define SPACE_WORLD_SHIFT 4 // World x and y in 1/16 px at scale 1
+#define SPACE_VANISH_X 32 // Vanishing point, middle of the view
+#define SPACE_HORIZON 36 // Top of the view; objects fly below the line of sight
+#define SPACE_MANEUVERS 9 // screen_type values, 0 forward to 8 dock
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t size;
+} SpacePoint;
+
+typedef struct {
+    int16_t dx; // World 1/16 px per update
+    int16_t dy;
+    int16_t dz; // Depth steps per update, negative toward the ship
+} SpaceVelocity;
+
+// Q8 scale of each depth, SPACE_FOCAL / (z + SPACE_NEAR)
+extern const uint16_t space_scale[SPACE_DEPTHS];
+
+// Velocity of every object for a maneuver at speed steps per update
+void space_velocity(SpaceVelocity* velocity, int screen_type, int speed);
+
+// Screen position and radius of a live object
+static inline SpacePoint space_project(const EntityPool* pool, uint8_t id) {
+    int z = pool->z[id] < 0 ? 0 : pool->z[id] > SPACE_Z_FAR ? SPACE_Z_FAR : pool->z[id];
+    int32_t scale = space_scale[z];
+    SpacePoint point = {
+        SPACE_VANISH_X + ((pool->x[id] * scale) >> (SPACE_SCALE_SHIFT + SPACE_WORLD_SHIFT)),
+        SPACE_HORIZON + ((pool->y[id] * scale) >> (SPACE_SCALE_SHIFT + SPACE_WORLD_SHIFT)),
+        (pool->size[id] * scale) >> SPACE_SCALE_SHIFT,
+    };
+    return point;
+}
+
+// Projected live objects, farthest first so nearer ones draw over them
+void space_publish(const EntityPool* pool, EntityList* list);
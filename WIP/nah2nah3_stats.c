@@ -0,0 +1,36 @@
+#include "nah2nah3_stats.h"
+#include "nah2nah3_save.h"
+
+#include <string.h>
+#include <storage/storage.h>
+
+#define STATS_PATH APP_DATA_PATH("stats.bin")
+#define STATS_TEMP_PATH APP_DATA_PATH("stats.tmp")
+
+static bool stats_valid(const StatsFile* file) {
+    return file->magic == STATS_MAGIC && file->version == STATS_VERSION && file->mode_count == STATS_MODES &&
+           file->record_size == sizeof(StatsRecord);
+}
+
+void stats_load(Stats* stats) {
+    memset(stats, 0, sizeof(Stats));
+    atomic_store(&stats->dirty, false);
+    if(save_read_any(STATS_PATH, STATS_TEMP_PATH, &stats->file, sizeof(StatsFile)) != sizeof(StatsFile) ||
+       !stats_valid(&stats->file)) {
+        memset(&stats->file, 0, sizeof(StatsFile));
+    }
+    stats->file.magic = STATS_MAGIC;
+    stats->file.version = STATS_VERSION;
+    stats->file.mode_count = STATS_MODES;
+    stats->file.record_size = sizeof(StatsRecord);
+}
+
+void stats_flush(Stats* stats) {
+    if(!atomic_exchange(&stats->dirty, false)) return;
+    StatsFile copy = stats->file; // A fold landing mid-write sets dirty again
+    if(save_write(STATS_PATH, STATS_TEMP_PATH, &copy, sizeof(copy))) {
+        stats->writes++;
+    } else {
+        stats->failed++;
+    }
+}
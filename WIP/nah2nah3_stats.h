@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+// Lifetime stats, one record per game mode, in a single small file. The game
+// folds into RAM; the app thread writes the whole file through save_write.
+
+#define STATS_MAGIC 0x5453414EU // "NAST" little endian
+#define STATS_VERSION 1
+#define STATS_MODES 6 // GameMode count, checked in nah2nah3.c
+
+typedef struct {
+    uint32_t plays; // Sessions started
+    int32_t best_score;
+    int32_t best_streak;
+    uint32_t streak_sum; // Over every session, for the lifetime average
+    uint32_t streak_count;
+    uint32_t score_total; // PP for Flip IQ
+} StatsRecord;
+
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t mode_count;
+    uint16_t record_size;
+    StatsRecord records[STATS_MODES];
+} StatsFile;
+
+typedef struct {
+    StatsFile file;
+    atomic_bool dirty; // Set by the game thread, cleared by the writer
+    uint32_t writes;
+    uint32_t failed; // Writes that left the old file in place
+} Stats;
+
+// One read at startup; a missing or foreign file starts from zero
+void stats_load(Stats* stats);
+
+// App thread: write the file if anything was folded since the last write
+void stats_flush(Stats* stats);
@@ -0,0 +1,50 @@
+#include "nah2nah3_text.h"
+
+#include <string.h>
+
+static char text_span[TEXT_SPAN_MAX + 1]; // GUI thread only, like the cache
+
+uint16_t text_measure(Canvas* canvas, Font font, const char* text) {
+    canvas_set_font(canvas, font);
+    return canvas_string_width(canvas, text);
+}
+
+uint16_t text_span_measure(Canvas* canvas, Font font, const char* text, uint8_t length) {
+    if(length > TEXT_SPAN_MAX) length = TEXT_SPAN_MAX;
+    memcpy(text_span, text, length);
+    text_span[length] = '\0';
+    return text_measure(canvas, font, text_span);
+}
+
+// Direct mapped on the address, a collision only costs a re-measure. Words
+// start at any byte, so the low address bits are kept.
+static TextCacheEntry* text_slot(TextCache* cache, Font font, const char* text, uint8_t length) {
+    uintptr_t key = (uintptr_t)text ^ ((uintptr_t)text >> 6) ^ (uintptr_t)font ^ length;
+    return &cache->entries[key & (TEXT_CACHE_SIZE - 1)];
+}
+
+uint16_t text_width(TextCache* cache, Canvas* canvas, Font font, const char* text) {
+    TextCacheEntry* entry = text_slot(cache, font, text, 0);
+    if(entry->text == text && entry->font == font && entry->length == 0) {
+        canvas_set_font(canvas, font);
+        return entry->width;
+    }
+    entry->text = text;
+    entry->font = font;
+    entry->length = 0;
+    entry->width = text_measure(canvas, font, text);
+    return entry->width;
+}
+
+uint16_t text_span_width(TextCache* cache, Canvas* canvas, Font font, const char* text, uint8_t length) {
+    TextCacheEntry* entry = text_slot(cache, font, text, length);
+    if(entry->text == text && entry->font == font && entry->length == length) {
+        canvas_set_font(canvas, font);
+        return entry->width;
+    }
+    entry->text = text;
+    entry->font = font;
+    entry->length = length;
+    entry->width = text_span_measure(canvas, font, text, length);
+    return entry->width;
+}
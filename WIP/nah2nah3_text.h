@@ -0,0 +1,41 @@
+#pragma once
+
+#include <gui/gui.h>
+#include <stdint.h>
+
+// Text widths from the real font metrics. Static strings are interned by
+// address, so each is measured once per font; formatted text is measured as
+// drawn. Spans measure part of a string, one word of it for wrapping.
+// GUI thread only, canvas_string_width needs the canvas.
+
+#define TEXT_CACHE_SIZE 64 // Power of two, more than the strings and words on any one screen
+#define TEXT_SPAN_MAX 31 // Longest span measured, in characters
+
+typedef struct {
+    const char* text; // NULL when the slot is free
+    uint8_t font;
+    uint8_t length; // Characters measured, 0 for the whole string
+    uint16_t width;
+} TextCacheEntry;
+
+typedef struct {
+    TextCacheEntry entries[TEXT_CACHE_SIZE];
+} TextCache; // Zeroed is empty
+
+// Width of a string with static storage, cached by its address. Leaves font set.
+uint16_t text_width(TextCache* cache, Canvas* canvas, Font font, const char* text);
+
+// Width of any string, for text formatted into a scratch buffer. Leaves font set.
+uint16_t text_measure(Canvas* canvas, Font font, const char* text);
+
+// Width of the first length characters of a static string, cached by address
+// and length. Leaves font set.
+uint16_t text_span_width(TextCache* cache, Canvas* canvas, Font font, const char* text, uint8_t length);
+
+// Width of the first length characters of any string. Leaves font set.
+uint16_t text_span_measure(Canvas* canvas, Font font, const char* text, uint8_t length);
+
+// Left edge that centres width in span
+static inline int text_center(int span, uint16_t width) {
+    return (span - (int)width) / 2;
+}
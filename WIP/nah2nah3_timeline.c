@@ -0,0 +1,51 @@
+#include "nah2nah3_timeline.h"
+
+fx_t timeline_ease(TimelineEase ease, fx_t t) {
+    switch(ease) {
+    case TimelineEaseIn:
+        return fx_mul(t, t);
+    case TimelineEaseOut:
+        return fx_mul(t, (FX_ONE << 1) - t);
+    case TimelineEaseInOut:
+        // t of 1.0 is half a turn in binary angle units
+        return (FX_ONE - fx_cos((fx_angle_t)(t >> 1))) >> 1;
+    case TimelineEaseStep:
+        return 0;
+    default:
+        return t;
+    }
+}
+
+fx_t timeline_track_eval(const TimelineTrack* track, uint32_t time_ms) {
+    if(!track || track->key_count == 0) return 0;
+    const TimelineKey* keys = track->keys;
+    const TimelineKey* last = &keys[track->key_count - 1];
+    if(track->loop && last->time_ms > 0) time_ms %= last->time_ms;
+    if(time_ms <= keys[0].time_ms) return keys[0].value;
+    if(time_ms >= last->time_ms) return last->value;
+
+    uint8_t i = 0;
+    while(keys[i + 1].time_ms <= time_ms) i++;
+    const TimelineKey* from = &keys[i];
+    const TimelineKey* to = &keys[i + 1];
+    fx_t t = (fx_t)(((uint64_t)(time_ms - from->time_ms) << FX_SHIFT) / (to->time_ms - from->time_ms));
+    return fx_lerp(from->value, to->value, timeline_ease(from->ease, t));
+}
+
+void timeline_table_bake(TimelineTable* table) {
+    if(!table || !table->frames) return;
+    for(uint16_t i = 0; i < table->frame_count; i++) {
+        table->frames[i] = (int16_t)fx_round(timeline_track_eval(table->track, (uint32_t)i * table->frame_ms));
+    }
+}
+
+int16_t timeline_table_sample(const TimelineTable* table, uint32_t time_ms) {
+    if(!table || table->frame_count == 0) return 0;
+    uint32_t frame = time_ms / table->frame_ms;
+    if(table->track->loop) {
+        frame %= table->frame_count;
+    } else if(frame >= table->frame_count) {
+        frame = table->frame_count - 1;
+    }
+    return table->frames[frame];
+}
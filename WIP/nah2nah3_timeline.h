@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "nah2nah3_fixed.h"
+
+// Curve used between a keyframe and the next one
+typedef enum {
+    TimelineEaseLinear,
+    TimelineEaseIn, // Quadratic, slow start
+    TimelineEaseOut, // Quadratic, slow finish
+    TimelineEaseInOut, // Half cosine
+    TimelineEaseStep, // Hold the value until the next key
+} TimelineEase;
+
+typedef struct {
+    uint32_t time_ms;
+    fx_t value;
+    TimelineEase ease;
+} TimelineKey;
+
+// Keys must be sorted by time; a looping track wraps at its last key
+typedef struct {
+    const TimelineKey* keys;
+    uint8_t key_count;
+    bool loop;
+} TimelineTrack;
+
+// Track sampled at a fixed frame rate into whole units, baked once at startup
+typedef struct {
+    const TimelineTrack* track;
+    int16_t* frames;
+    uint16_t frame_count;
+    uint16_t frame_ms;
+} TimelineTable;
+
+fx_t timeline_ease(TimelineEase ease, fx_t t);
+
+fx_t timeline_track_eval(const TimelineTrack* track, uint32_t time_ms);
+
+void timeline_table_bake(TimelineTable* table);
+
+int16_t timeline_table_sample(const TimelineTable* table, uint32_t time_ms);
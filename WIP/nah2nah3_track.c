@@ -0,0 +1,67 @@
+#include "nah2nah3_track.h"
+
+#include <stddef.h>
+
+static TrackSegment* track_slot(Track* track, int i) {
+    return &track->segments[(track->tail + i) & (TRACK_RING - 1)];
+}
+
+void track_clear(Track* track, int16_t y) {
+    track->top = y;
+    track->tail = 0;
+    track->count = 0;
+    track->cursor = 0;
+}
+
+bool track_push(Track* track, uint8_t lane, uint8_t length) {
+    if(track->count >= TRACK_RING) return false;
+    TrackSegment* segment = track_slot(track, track->count++);
+    segment->y = track->top;
+    segment->length = length;
+    segment->lane = lane;
+    track->top -= length;
+    return true;
+}
+
+void track_scroll(Track* track, int dy, int bottom) {
+    for(int i = 0; i < track->count; i++) track_slot(track, i)->y += dy;
+    track->top += dy;
+    while(track->count && track_get(track, 0)->y - track_get(track, 0)->length > bottom) {
+        track->tail = (track->tail + 1) & (TRACK_RING - 1);
+        track->count--;
+        if(track->cursor) track->cursor--;
+    }
+}
+
+// Index of the segment covering row y, walking from the cursor; -1 if none
+static int track_find(const Track* track, int y) {
+    if(!track->count || y > track_get(track, 0)->y || y <= track->top) return -1;
+    int i = track->cursor < track->count ? track->cursor : 0;
+    while(y > track_get(track, i)->y) i--; // Below, toward the tail
+    while(y <= track_get(track, i)->y - track_get(track, i)->length) i++; // Above, toward the newest
+    return i;
+}
+
+const TrackSegment* track_at(const Track* track, int y) {
+    int i = track_find(track, y);
+    return i < 0 ? NULL : track_get(track, i);
+}
+
+void track_follow(Track* track, int y) {
+    int i = track_find(track, y);
+    if(i >= 0) track->cursor = i;
+}
+
+void track_rebuild(Track* track, int16_t y) {
+    bool valid = track->tail < TRACK_RING && track->count <= TRACK_RING;
+    for(int i = 0; valid && i < track->count; i++) {
+        const TrackSegment* segment = track_get(track, i);
+        int16_t end = i + 1 < track->count ? track_get(track, i + 1)->y : track->top;
+        valid = segment->length > 0 && segment->lane < TRACK_LANES && segment->y - segment->length == end;
+    }
+    if(!valid) {
+        track_clear(track, y);
+    } else if(track->cursor >= track->count) {
+        track->cursor = 0;
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Line Car track: one connected path of segments in a ring, oldest at the
+// bottom of the screen. Each segment starts where the one before it ends, so
+// there are no gaps and no overlaps. Segments retire off the bottom and the
+// game pushes new ones above the top. A cursor remembers the segment under
+// the car, and lookups walk from it, a step or two at most.
+
+#define TRACK_RING 32 // Power of two; 128 rows of 9px segments need 16
+#define TRACK_LANES 5
+
+typedef struct {
+    int16_t y; // Bottom end, where the segment starts
+    uint8_t length;
+    uint8_t lane;
+} TrackSegment;
+
+typedef struct {
+    TrackSegment segments[TRACK_RING];
+    int16_t top; // Where the next segment starts, the top end of the newest
+    uint8_t tail; // Oldest segment
+    uint8_t count;
+    uint8_t cursor; // Segment under the car, counted from the tail
+} Track;
+
+// Empty track whose first segment will start at y
+void track_clear(Track* track, int16_t y);
+
+// Segment i from the bottom, 0 is the oldest
+static inline const TrackSegment* track_get(const Track* track, int i) {
+    return &track->segments[(track->tail + i) & (TRACK_RING - 1)];
+}
+
+// Add a segment above the newest, false when the ring is full
+bool track_push(Track* track, uint8_t lane, uint8_t length);
+
+// Move everything down by dy and retire segments wholly below bottom
+void track_scroll(Track* track, int dy, int bottom);
+
+// Segment covering row y, NULL above or below the track
+const TrackSegment* track_at(const Track* track, int y);
+
+// Timer thread: move the cursor to the segment covering row y
+void track_follow(Track* track, int y);
+
+// Check a restored ring, clearing it if anything does not fit together
+void track_rebuild(Track* track, int16_t y);
@@ -0,0 +1,115 @@
+#include "nah2nah3_tts.h"
+
+#include <string.h>
+#include <furi_hal_speaker.h>
+#include <storage/storage.h>
+
+#define TTS_FLAG_WAKE (1U << 0)
+
+const char* const tts_phrases[TTS_PHRASE_COUNT] = {
+    // TTS_ROW_BASED
+    "I don't know boys, I didn't say it.", "That's a One Boys", "1 in chat", "Don't let the other side base you down brothers",
+    // TTS_ROW_CUTE
+    "Well, I am six-six chunky hunky", "Look right here", ";-)", "<3",
+    // TTS_ROW_ANGER
+    "Slams Desk", "Cursing", "Ranting", "Beep Sounds",
+    // TTS_ROW_SAD
+    "Repeats Based", "Pumps Gun", "Eyebrows Up", "Points Up",
+    "HYPE TRAIN",
+    "Beep Beep",
+};
+
+#if USE_SAM_TTS
+// Next phrase to speak, also marks it as the one playing
+static bool tts_pop(Tts* tts, uint8_t* phrase) {
+    furi_mutex_acquire(tts->mutex, FuriWaitForever);
+    bool popped = tts->queue_count > 0;
+    if(popped) {
+        *phrase = tts->queue[tts->queue_head];
+        tts->queue_head = (tts->queue_head + 1) % TTS_QUEUE_SIZE;
+        tts->queue_count--;
+    }
+    tts->speaking = popped ? *phrase : TTS_PHRASE_NONE;
+    furi_mutex_release(tts->mutex);
+    return popped;
+}
+
+static void tts_speak(Tts* tts, uint8_t phrase) {
+    if(furi_hal_speaker_is_mine() || furi_hal_speaker_acquire(TTS_SPEAKER_TIMEOUT_MS)) {
+        const uint8_t* pcm = pcm_cache_get(&tts->cache, phrase);
+        if(pcm) {
+            pcm_play(&tts->cache, phrase, pcm);
+            furi_hal_speaker_release();
+            return;
+        }
+        char upper_text[TTS_TEXT_MAX];
+        strncpy(upper_text, tts_phrases[phrase], sizeof(upper_text) - 1);
+        upper_text[sizeof(upper_text) - 1] = '\0';
+        for(size_t i = 0; upper_text[i] != '\0'; i++) {
+            if(upper_text[i] >= 'a' && upper_text[i] <= 'z') {
+                upper_text[i] = upper_text[i] - 'a' + 'A';
+            }
+        }
+        sam_say(&tts->voice, upper_text);
+        furi_hal_speaker_release();
+    }
+}
+
+static int32_t tts_worker(void* context) {
+    Tts* tts = context;
+    // Load the asset off the app thread and warm the lines that repeat most
+    if(pcm_cache_open(&tts->cache, TTS_PCM_PATH)) {
+        pcm_cache_get(&tts->cache, TTS_PHRASE_HYPE_TRAIN);
+        pcm_cache_get(&tts->cache, TTS_PHRASE_BEEP);
+    }
+    while(!tts->stopping) {
+        furi_thread_flags_wait(TTS_FLAG_WAKE, FuriFlagWaitAny, FuriWaitForever);
+        uint8_t phrase;
+        while(!tts->stopping && tts_pop(tts, &phrase)) {
+            tts_speak(tts, phrase);
+        }
+    }
+    pcm_cache_close(&tts->cache);
+    return 0;
+}
+
+void tts_start(Tts* tts) {
+    memset(tts, 0, sizeof(Tts));
+    tts->speaking = TTS_PHRASE_NONE;
+    tts->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    sam_init(&tts->voice);
+    tts->thread = furi_thread_alloc_ex("Nah2Nah3Tts", TTS_STACK_SIZE, tts_worker, tts);
+    furi_thread_set_priority(tts->thread, FuriThreadPriorityLow);
+    furi_thread_start(tts->thread);
+}
+
+void tts_stop(Tts* tts) {
+    if(!tts->thread) return;
+    tts->stopping = true;
+    furi_thread_flags_set(furi_thread_get_id(tts->thread), TTS_FLAG_WAKE);
+    furi_thread_join(tts->thread); // Waits out a phrase already playing
+    furi_thread_free(tts->thread);
+    furi_mutex_free(tts->mutex);
+    tts->thread = NULL;
+}
+
+void tts_say(Tts* tts, TtsPhrase phrase) {
+    if(!tts->thread || phrase >= TTS_PHRASE_COUNT) return;
+    furi_mutex_acquire(tts->mutex, FuriWaitForever);
+    bool queued = tts->speaking == phrase;
+    for(uint8_t i = 0; i < tts->queue_count && !queued; i++) {
+        queued = tts->queue[(tts->queue_head + i) % TTS_QUEUE_SIZE] == phrase;
+    }
+    if(!queued) {
+        if(tts->queue_count == TTS_QUEUE_SIZE) { // Drop the oldest, the newest fits the scene
+            tts->queue_head = (tts->queue_head + 1) % TTS_QUEUE_SIZE;
+            tts->queue_count--;
+            tts->dropped++;
+        }
+        tts->queue[(tts->queue_head + tts->queue_count) % TTS_QUEUE_SIZE] = phrase;
+        tts->queue_count++;
+    }
+    furi_mutex_release(tts->mutex);
+    if(!queued) furi_thread_flags_set(furi_thread_get_id(tts->thread), TTS_FLAG_WAKE);
+}
+#endif // USE_SAM_TTS
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <furi.h>
+#include "stm32_sam.h"
+#include "nah2nah3_pcm.h"
+
+// SAM speech on a low-priority worker thread. The game only queues phrase IDs;
+// synthesis and the speaker are never touched from the timer thread. Phrases in
+// the pre-synthesized asset are streamed from the PCM cache instead of SAM.
+
+// Off unless the build sets it, SAM is not in every checkout
+#ifndef USE_SAM_TTS
+#define USE_SAM_TTS 0
+#endif
+
+#define TTS_QUEUE_SIZE 4 // Oldest waiting phrase is dropped past this
+#define TTS_STACK_SIZE (2 * 1024)
+#define TTS_SPEAKER_TIMEOUT_MS 1000
+#define TTS_TEXT_MAX 32
+#define TTS_PCM_PATH APP_DATA_PATH("phrases.pcm")
+
+// Tectone emotion rows, four phrases each
+typedef enum {
+    TTS_ROW_BASED,
+    TTS_ROW_CUTE,
+    TTS_ROW_ANGER,
+    TTS_ROW_SAD,
+    TTS_ROW_COUNT
+} TtsRow;
+
+typedef enum {
+    TTS_PHRASE_HYPE_TRAIN = TTS_ROW_COUNT * 4,
+    TTS_PHRASE_BEEP,
+    TTS_PHRASE_COUNT,
+    TTS_PHRASE_NONE = 0xFF
+} TtsPhrase;
+
+#define TTS_PHRASE_EMOTION(row, idx) ((TtsPhrase)((row) * 4 + (idx)))
+
+typedef struct {
+    FuriThread* thread;
+    FuriMutex* mutex; // Guards the queue only, never held while speaking
+    uint8_t queue[TTS_QUEUE_SIZE];
+    uint8_t queue_head;
+    uint8_t queue_count;
+    uint8_t speaking; // Phrase on the speaker, TTS_PHRASE_NONE when idle
+    volatile bool stopping;
+    uint32_t dropped;
+    STM32SAM voice;
+    PcmCache cache; // Worker thread only
+} Tts;
+
+extern const char* const tts_phrases[TTS_PHRASE_COUNT];
+
+void tts_start(Tts* tts);
+void tts_stop(Tts* tts);
+
+// Queue a phrase unless it is already queued or playing; returns at once
+void tts_say(Tts* tts, TtsPhrase phrase);
@@ -0,0 +1,122 @@
+#include "nah2nah3_tuning.h"
+#include "nah2nah3_save.h"
+
+#include <string.h>
+#include <storage/storage.h>
+
+#define TUNING_PATH APP_DATA_PATH("tuning.txt")
+
+#define TUNING_FIELD(field, lo, hi) {#field, offsetof(GameTuning, field), sizeof(((GameTuning*)0)->field), lo, hi}
+
+const GameTuning tuning_default = {
+    .difficulty_cooldown_ms = COOLDOWN_MS,
+    .drift_ms = DRIFT_MS,
+    .space_combo_cooldown_ms = SPACE_COMBO_COOLDOWN_MS,
+    .fps_base = FPS_BASE,
+    .difficulty_streak_factor = DIFFICULTY_STREAK_FACTOR,
+    .difficulty_min_streak = DIFFICULTY_MIN_STREAK,
+    .note_spawn_ticks = NOTE_SPAWN_TICKS,
+    .obstacle_spawn_ticks = OBSTACLE_SPAWN_TICKS,
+    .ball_spawn_ticks = BALL_SPAWN_TICKS,
+    .speed_step_jumps = SPEED_STEP_JUMPS,
+    .speed_step_bpm = SPEED_STEP_BPM,
+    .speed_max_bpm = MAX_SPEED_BPM,
+    .space_spawn_pct = SPACE_SPAWN_PCT,
+    .space_damage_pct = SPACE_DAMAGE_PCT,
+    .space_armor_pickup_pct = SPACE_ARMOR_PICKUP_PCT,
+};
+
+const TuningField tuning_fields[] = {
+    TUNING_FIELD(fps_base, 10, 50), // Timer period stays at 20ms or more
+    TUNING_FIELD(difficulty_cooldown_ms, 0, 3600000),
+    TUNING_FIELD(difficulty_streak_factor, 1, 20),
+    TUNING_FIELD(difficulty_min_streak, 0, 100),
+    TUNING_FIELD(note_spawn_ticks, 1, 100),
+    TUNING_FIELD(obstacle_spawn_ticks, 1, 100),
+    TUNING_FIELD(ball_spawn_ticks, 1, 100),
+    TUNING_FIELD(speed_step_jumps, 1, 100),
+    TUNING_FIELD(speed_step_bpm, 0, 50),
+    TUNING_FIELD(speed_max_bpm, 66, 250), // Above MIN_SPEED_BPM, the speed bar divides by the gap
+    TUNING_FIELD(drift_ms, 100, 5000),
+    TUNING_FIELD(space_spawn_pct, 0, 100),
+    TUNING_FIELD(space_damage_pct, 0, 255),
+    TUNING_FIELD(space_armor_pickup_pct, 0, 100),
+    TUNING_FIELD(space_combo_cooldown_ms, 0, 10000),
+};
+
+const size_t tuning_field_count = sizeof(tuning_fields) / sizeof(tuning_fields[0]);
+
+uint32_t tuning_get(const GameTuning* tuning, const TuningField* field) {
+    const uint8_t* base = (const uint8_t*)tuning + field->offset;
+    if(field->size == sizeof(uint32_t)) return *(const uint32_t*)base;
+    if(field->size == sizeof(uint16_t)) return *(const uint16_t*)base;
+    return *base;
+}
+
+void tuning_set(GameTuning* tuning, const TuningField* field, uint32_t value) {
+    if(value < field->min) value = field->min;
+    if(value > field->max) value = field->max;
+    uint8_t* base = (uint8_t*)tuning + field->offset;
+    if(field->size == sizeof(uint32_t)) {
+        *(uint32_t*)base = value;
+    } else if(field->size == sizeof(uint16_t)) {
+        *(uint16_t*)base = value;
+    } else {
+        *base = value;
+    }
+}
+
+const TuningField* tuning_field_find(const char* name, size_t length) {
+    for(size_t i = 0; i < tuning_field_count; i++) {
+        if(strlen(tuning_fields[i].name) == length && strncmp(tuning_fields[i].name, name, length) == 0) {
+            return &tuning_fields[i];
+        }
+    }
+    return NULL;
+}
+
+static bool tuning_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+uint8_t tuning_parse(GameTuning* tuning, const char* text, size_t length) {
+    uint8_t applied = 0;
+    const char* end = text + length;
+    while(text < end) {
+        const char* line_end = memchr(text, '\n', end - text);
+        if(!line_end) line_end = end;
+        const char* comment = memchr(text, '#', line_end - text);
+        const char* stop = comment ? comment : line_end;
+        const char* eq = memchr(text, '=', stop - text);
+        if(eq) {
+            const char* name = text;
+            const char* name_end = eq;
+            while(name < name_end && tuning_space(*name)) name++;
+            while(name_end > name && tuning_space(name_end[-1])) name_end--;
+            const char* digit = eq + 1;
+            while(digit < stop && tuning_space(*digit)) digit++;
+            uint32_t value = 0;
+            const char* first = digit;
+            while(digit < stop && *digit >= '0' && *digit <= '9' && value < UINT32_MAX / 10) {
+                value = value * 10 + (*digit++ - '0');
+            }
+            while(digit < stop && tuning_space(*digit)) digit++;
+            const TuningField* field = tuning_field_find(name, name_end - name);
+            if(field && digit > first && digit == stop) {
+                tuning_set(tuning, field, value);
+                applied++;
+            }
+        }
+        text = line_end + 1;
+    }
+    return applied;
+}
+
+uint8_t tuning_load(GameTuning* tuning, Arena* arena) {
+    size_t mark = arena_mark(arena);
+    char* text = arena_alloc(arena, TUNING_FILE_MAX);
+    uint8_t applied = 0;
+    if(text) applied = tuning_parse(tuning, text, save_read(TUNING_PATH, text, TUNING_FILE_MAX));
+    arena_rewind(arena, mark);
+    return applied;
+}
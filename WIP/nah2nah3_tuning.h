@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "nah2nah3_arena.h"
+
+// Gameplay and pacing knobs in one struct. The compiled defaults can be
+// overridden per device by tuning.txt in apps_data, one name=value per line
+// and # for comments, read once at startup. The host tools sweep the same
+// fields by name.
+
+#define TUNING_FILE_MAX 512 // Longer files are cut here, read through the mode arena
+
+// Defaults for GameTuning
+#define FPS_BASE 22 // Timer rate; the games speed up from here
+#define COOLDOWN_MS 180000 // Zero Hero: 3 minutes between difficulty steps
+#define DIFFICULTY_STREAK_FACTOR 3 // Zero Hero steps up once the streak is 3x the average
+#define DIFFICULTY_MIN_STREAK 5
+#define NOTE_SPAWN_TICKS 10 // Zero Hero: one note every 10 updates
+#define OBSTACLE_SPAWN_TICKS 15 // Flip Zip: one obstacle every 15 updates
+#define BALL_SPAWN_TICKS 15 // Flip IQ: one ball every 15 updates
+#define SPEED_STEP_JUMPS 5 // Flip Zip: speed up every 5 successful jumps
+#define SPEED_STEP_BPM 10
+#define MAX_SPEED_BPM 120 // Cap for BPM rewards, right end of the speed bar
+#define DRIFT_MS 693 // Line Car: drift length before it scores
+#define SPACE_SPAWN_PCT 10 // Space Flight: spawn chance per free slot per update
+#define SPACE_DAMAGE_PCT 100 // Space Flight: scales size-based damage
+#define SPACE_ARMOR_PICKUP_PCT 25
+#define SPACE_COMBO_COOLDOWN_MS 1963 // Space Flight: gap after a maneuver before the next can fire
+
+// Widest fields first, so the struct packs without padding
+typedef struct {
+    uint32_t difficulty_cooldown_ms; // Zero Hero: minimum gap between difficulty steps
+    uint16_t drift_ms;
+    uint16_t space_combo_cooldown_ms;
+    uint8_t fps_base;
+    uint8_t difficulty_streak_factor;
+    uint8_t difficulty_min_streak;
+    uint8_t note_spawn_ticks;
+    uint8_t obstacle_spawn_ticks;
+    uint8_t ball_spawn_ticks;
+    uint8_t speed_step_jumps;
+    uint8_t speed_step_bpm;
+    uint8_t speed_max_bpm;
+    uint8_t space_spawn_pct;
+    uint8_t space_damage_pct;
+    uint8_t space_armor_pickup_pct;
+} GameTuning;
+
+typedef struct {
+    const char* name;
+    uint8_t offset;
+    uint8_t size;
+    uint32_t min; // Values are clamped into min..max, so a file cannot divide by zero
+    uint32_t max;
+} TuningField;
+
+extern const GameTuning tuning_default;
+extern const TuningField tuning_fields[];
+extern const size_t tuning_field_count;
+
+uint32_t tuning_get(const GameTuning* tuning, const TuningField* field);
+void tuning_set(GameTuning* tuning, const TuningField* field, uint32_t value);
+
+// Field named by the first length chars of name, NULL if there is none
+const TuningField* tuning_field_find(const char* name, size_t length);
+
+// Apply name=value lines; unknown names and malformed lines are skipped.
+// Returns how many values were applied.
+uint8_t tuning_parse(GameTuning* tuning, const char* text, size_t length);
+
+// Read and apply tuning.txt if there is one. The file is read into arena and
+// rewound off it again; returns how many values were applied.
+uint8_t tuning_load(GameTuning* tuning, Arena* arena);